@@ -0,0 +1,129 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PackedDateTime.hpp"
+
+/** @file Export and import of timestamp and date columns through the
+    Apache Arrow C Data Interface, without depending on Arrow.
+
+    PackedDateTime columns are exported as timestamp[us, UTC], i.e.
+    microseconds since 1970-01-01 without leap seconds, and Date columns
+    as date32, days since 1970-01-01. Leap seconds are exported as the
+    following 00:00:00, as in UnixTime.hpp.
+
+    The exported arrays own their buffers, the consumer calls the release
+    callbacks when it is done with them.
+*/
+
+extern "C"
+{
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema
+{
+    // Array type description
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+struct ArrowArray
+{
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+}
+
+namespace Ytime
+{
+    /**
+     * @brief Exports @a values as a timestamp[us, UTC] array.
+     *
+     * The values are converted into a buffer owned by @a array.
+     */
+    void exportTimestamps(const PackedDateTime* values, size_t count,
+                          ArrowArray* array, ArrowSchema* schema);
+
+    /**
+     * @brief Exports @a values as a timestamp[us, UTC] array, converting
+     *      them in place.
+     *
+     * @a array takes over the vector's buffer, there is no copy.
+     */
+    void exportTimestamps(std::vector<PackedDateTime>&& values,
+                          ArrowArray* array, ArrowSchema* schema);
+
+    /**
+     * @brief Exports @a values as a date32 array.
+     */
+    void exportDates(const Date* values, size_t count,
+                     ArrowArray* array, ArrowSchema* schema);
+
+    /**
+     * @brief Converts a timestamp array with any unit (s, ms, us or ns)
+     *      to PackedDateTime and writes @a array->length values to
+     *      @a result.
+     *
+     * Timestamps with a time zone are instants and are read as UTC,
+     * timestamps without one are read as UTC too. Nanoseconds are
+     * truncated to microseconds. Null values are written as
+     * @a nullValue. Values before 1200-03-01, the first PackedDateTime,
+     * or too large to be represented are clamped.
+     *
+     * The arrays are not released.
+     *
+     * @throw YtimeException if the schema isn't a timestamp or the array
+     *      has an unexpected layout.
+     */
+    void importTimestamps(const ArrowArray* array, const ArrowSchema* schema,
+                          PackedDateTime* result,
+                          PackedDateTime nullValue = {});
+
+    /**
+     * @brief Converts a date32 or date64 array to Dates and writes
+     *      @a array->length values to @a result.
+     *
+     * Null values are written as @a nullValue.
+     *
+     * @throw YtimeException if the schema isn't a date or the array has
+     *      an unexpected layout.
+     */
+    void importDates(const ArrowArray* array, const ArrowSchema* schema,
+                     Date* result, Date nullValue = {});
+}
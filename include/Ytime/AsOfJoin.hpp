@@ -0,0 +1,62 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <optional>
+#include "PackedDateTime.hpp"
+
+namespace Ytime
+{
+    enum class AsOfDirection
+    {
+        /** Match the last right value at or before the left value. */
+        BACKWARD,
+        /** Match the first right value at or after the left value. */
+        FORWARD,
+        /** Match the closest of BACKWARD and FORWARD, BACKWARD on ties. */
+        NEAREST
+    };
+
+    /** @brief The index written for left values without a match. */
+    constexpr size_t ASOF_NO_MATCH = ~size_t(0);
+
+    /**
+     * @brief For each value in @a left, writes the index of the matching
+     *      value in @a right to @a result.
+     *
+     * Both @a left and @a right must be sorted. The two arrays are
+     * merged in a single pass, runs of right values are skipped in
+     * blocks.
+     *
+     * @param tolerance If given, matches further away than this (in
+     *      elapsed time) are replaced with ASOF_NO_MATCH.
+     * @throw YtimeException if @a tolerance is negative.
+     */
+    void asOfJoin(const PackedDateTime* left, size_t leftCount,
+                  const PackedDateTime* right, size_t rightCount,
+                  size_t* result,
+                  AsOfDirection direction = AsOfDirection::BACKWARD,
+                  std::optional<DateTimeDelta> tolerance = {});
+
+    /**
+     * @brief Does the same as asOfJoin, but splits @a left into
+     *      partitions that are joined on separate threads.
+     *
+     * Each partition finds its starting point in @a right with a binary
+     * search. Small inputs are joined on the calling thread.
+     *
+     * @param threadCount The number of threads, 0 means one per
+     *      hardware thread.
+     */
+    void asOfJoinParallel(const PackedDateTime* left, size_t leftCount,
+                          const PackedDateTime* right, size_t rightCount,
+                          size_t* result,
+                          AsOfDirection direction = AsOfDirection::BACKWARD,
+                          std::optional<DateTimeDelta> tolerance = {},
+                          unsigned threadCount = 0);
+}
@@ -0,0 +1,89 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include "PackedDateTime.hpp"
+
+/** @file Julian Dates and Modified Julian Dates in UTC, TAI and TT.
+
+    TAI is UTC plus 10 seconds plus the leap seconds since 1972, TT is
+    TAI plus 32.184 seconds. Before 1972 TAI is taken to be UTC plus 10
+    seconds, the fractional offsets used at the time are not modelled.
+
+    In UTC a day with a leap second has 86401 seconds, and the fraction
+    of such a day is the elapsed time divided by 86401 seconds.
+
+    A Julian Date in a single double has a resolution of about 40
+    microseconds, a Modified Julian Date about 1 microsecond. The
+    DayFraction functions are exact to the microsecond.
+*/
+
+namespace Ytime
+{
+    enum class TimeScale
+    {
+        UTC,
+        TAI,
+        TT
+    };
+
+    /**
+     * @brief A whole number of days and the fraction of a day, 0 <=
+     *      fraction < 1.
+     */
+    struct DayFraction
+    {
+        int64_t day = 0;
+        double fraction = 0;
+    };
+
+    DayFraction toJulianDay(PackedDateTime dateTime,
+                            TimeScale scale = TimeScale::UTC) noexcept;
+
+    DayFraction toModifiedJulianDay(PackedDateTime dateTime,
+                                    TimeScale scale = TimeScale::UTC) noexcept;
+
+    PackedDateTime fromJulianDay(const DayFraction& jd,
+                                 TimeScale scale = TimeScale::UTC) noexcept;
+
+    PackedDateTime fromModifiedJulianDay(const DayFraction& mjd,
+                                         TimeScale scale = TimeScale::UTC) noexcept;
+
+    double toJulianDate(PackedDateTime dateTime,
+                        TimeScale scale = TimeScale::UTC) noexcept;
+
+    double toModifiedJulianDate(PackedDateTime dateTime,
+                                TimeScale scale = TimeScale::UTC) noexcept;
+
+    PackedDateTime fromJulianDate(double jd,
+                                  TimeScale scale = TimeScale::UTC) noexcept;
+
+    PackedDateTime fromModifiedJulianDate(double mjd,
+                                          TimeScale scale = TimeScale::UTC) noexcept;
+
+    /**
+     * @brief Returns TAI - UTC in microseconds at @a dateTime.
+     */
+    int64_t getTaiOffsetUsecs(PackedDateTime dateTime) noexcept;
+
+    void toModifiedJulianDay(const PackedDateTime* values, size_t count,
+                             DayFraction* result,
+                             TimeScale scale = TimeScale::UTC) noexcept;
+
+    void toModifiedJulianDate(const PackedDateTime* values, size_t count,
+                              double* result,
+                              TimeScale scale = TimeScale::UTC) noexcept;
+
+    void toJulianDate(const PackedDateTime* values, size_t count,
+                      double* result,
+                      TimeScale scale = TimeScale::UTC) noexcept;
+
+    void fromModifiedJulianDate(const double* values, size_t count,
+                                PackedDateTime* result,
+                                TimeScale scale = TimeScale::UTC) noexcept;
+}
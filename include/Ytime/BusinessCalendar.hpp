@@ -0,0 +1,100 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "DateTime.hpp"
+
+namespace Ytime
+{
+    /**
+     * @brief A calendar of business days between two dates, stored as
+     *      a bitmap with one bit per day.
+     *
+     * The number of business days before each 64-day word is stored
+     * too, counting business days and adding business days therefore
+     * only needs a popcount on the words at either end.
+     */
+    class BusinessCalendar
+    {
+    public:
+        /**
+         * @brief Bit (weekday - 1) is set for each weekday that is not
+         *      a business day.
+         */
+        static constexpr unsigned SATURDAY_AND_SUNDAY = 0x60u;
+
+        /**
+         * @brief Creates a calendar from @a first to and including
+         *      @a last.
+         *
+         * @throw YtimeException if either date is invalid or @a last
+         *      is before @a first.
+         */
+        BusinessCalendar(const Date& first, const Date& last,
+                         unsigned weekendDays = SATURDAY_AND_SUNDAY);
+
+        BusinessCalendar(const Date& first, const Date& last,
+                         const std::vector<Date>& holidays,
+                         unsigned weekendDays = SATURDAY_AND_SUNDAY);
+
+        Date first() const;
+
+        Date last() const;
+
+        /**
+         * @brief Makes @a date a non-business day.
+         *
+         * This is O(n) in the number of days in the calendar, prefer the
+         * constructor that takes a list of holidays.
+         */
+        void addHoliday(const Date& date);
+
+        bool isBusinessDay(const Date& date) const;
+
+        /**
+         * @brief Returns the number of business days from @a from up to,
+         *      but not including, @a to.
+         *
+         * The result is negative if @a to is before @a from. @a to can
+         * be the day after last().
+         */
+        int64_t businessDaysBetween(const Date& from, const Date& to) const;
+
+        /**
+         * @brief Returns the business day that is @a days business days
+         *      after @a date, or before if @a days is negative.
+         *
+         * @a date doesn't need to be a business day. Adding 1 to a
+         * Friday gives the following Monday, adding -1 to a Saturday
+         * gives the preceding Friday.
+         *
+         * @throw YtimeException if the result is outside the calendar.
+         */
+        Date addBusinessDays(const Date& date, int64_t days) const;
+
+        void businessDaysBetween(const Date* from, const Date* to,
+                                 size_t count, int64_t* result) const;
+
+        void addBusinessDays(const Date* dates, size_t count, int64_t days,
+                             Date* result) const;
+    private:
+        uint32_t getIndex(const Date& date, bool allowEnd = false) const;
+
+        int64_t countBefore(uint32_t index) const noexcept;
+
+        uint32_t findBusinessDay(int64_t n) const;
+
+        void updateCounts() noexcept;
+
+        uint32_t m_FirstDay;
+        uint32_t m_DayCount;
+        std::vector<uint64_t> m_Words;
+        std::vector<int64_t> m_Counts;
+    };
+}
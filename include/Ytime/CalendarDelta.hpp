@@ -0,0 +1,159 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <iosfwd>
+#include "PackedDateTime.hpp"
+
+namespace Ytime
+{
+    /**
+     * @brief Decides what happens when adding months gives a day that
+     *      doesn't exist in the resulting month, e.g. January 31st plus
+     *      one month.
+     */
+    enum class MonthEndPolicy
+    {
+        /** Use the last day of the month. */
+        CLAMP,
+        /** Continue into the next month, e.g. March 2nd. */
+        ROLL_OVER,
+        /** Like CLAMP, but if the original date is the last day of its
+            month, the result is also the last day of its month. */
+        END_OF_MONTH
+    };
+
+    /**
+     * @brief A number of calendar months followed by a DateTimeDelta.
+     *
+     * Months are added before the DateTimeDelta.
+     */
+    class CalendarDelta
+    {
+    public:
+        constexpr CalendarDelta() noexcept
+            : m_Months(), m_Delta()
+        {}
+
+        constexpr explicit CalendarDelta(int64_t months,
+                                         DateTimeDelta delta = {}) noexcept
+            : m_Months(months), m_Delta(delta)
+        {}
+
+        constexpr CalendarDelta(DateTimeDelta delta) noexcept
+            : m_Months(), m_Delta(delta)
+        {}
+
+        constexpr bool isEmpty() const noexcept
+        {
+            return m_Months == 0 && m_Delta.isEmpty();
+        }
+
+        constexpr int64_t months() const noexcept
+        {
+            return m_Months;
+        }
+
+        constexpr const DateTimeDelta& dateTimeDelta() const noexcept
+        {
+            return m_Delta;
+        }
+    private:
+        int64_t m_Months;
+        DateTimeDelta m_Delta;
+    };
+
+    constexpr bool
+    operator==(const CalendarDelta& a, const CalendarDelta& b) noexcept
+    {
+        return a.months() == b.months()
+               && a.dateTimeDelta() == b.dateTimeDelta();
+    }
+
+    constexpr bool
+    operator!=(const CalendarDelta& a, const CalendarDelta& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    constexpr CalendarDelta
+    operator+(const CalendarDelta& a, const CalendarDelta& b) noexcept
+    {
+        return CalendarDelta(a.months() + b.months(),
+                             a.dateTimeDelta() + b.dateTimeDelta());
+    }
+
+    constexpr CalendarDelta
+    operator-(const CalendarDelta& a, const CalendarDelta& b) noexcept
+    {
+        return CalendarDelta(a.months() - b.months(),
+                             a.dateTimeDelta() - b.dateTimeDelta());
+    }
+
+    constexpr CalendarDelta
+    operator-(const CalendarDelta& d) noexcept
+    {
+        return CalendarDelta(-d.months(), -d.dateTimeDelta());
+    }
+
+    constexpr CalendarDelta
+    operator*(const CalendarDelta& d, int64_t n) noexcept
+    {
+        return CalendarDelta(d.months() * n,
+                             DateTimeDelta(d.dateTimeDelta().days() * n,
+                                           d.dateTimeDelta().totalUseconds() * n));
+    }
+
+    std::ostream& operator<<(std::ostream& os, const CalendarDelta& d);
+
+    constexpr CalendarDelta Months(int64_t months) noexcept
+    {
+        return CalendarDelta(months);
+    }
+
+    constexpr CalendarDelta Years(int64_t years) noexcept
+    {
+        return CalendarDelta(years * 12);
+    }
+
+    Date addMonths(const Date& date, int64_t months,
+                   MonthEndPolicy policy = MonthEndPolicy::CLAMP);
+
+    /**
+     * @brief Adds the months in @a delta to the date of @a from, keeping
+     *      the time of day, then adds the DateTimeDelta.
+     *
+     * @throw YtimeException if @a from is a leap second and the delta
+     *      has months.
+     */
+    PackedDateTime add(PackedDateTime from, const CalendarDelta& delta,
+                       MonthEndPolicy policy = MonthEndPolicy::CLAMP);
+
+    /**
+     * @brief Returns the CalendarDelta with the largest number of whole
+     *      months that doesn't go past @a to, and the remainder as a
+     *      DateTimeDelta.
+     *
+     * Months are added with MonthEndPolicy::CLAMP.
+     */
+    CalendarDelta getCalendarDelta(PackedDateTime from, PackedDateTime to);
+
+    void add(const PackedDateTime* values, size_t count,
+             const CalendarDelta& delta, PackedDateTime* result,
+             MonthEndPolicy policy = MonthEndPolicy::CLAMP);
+
+    /**
+     * @brief Writes start, start + step, start + 2 * step etc. to
+     *      @a result.
+     *
+     * Each value is computed from @a start, a schedule on the 31st
+     * therefore returns to the 31st after shorter months.
+     */
+    void makeSchedule(PackedDateTime start, const CalendarDelta& step,
+                      size_t count, PackedDateTime* result,
+                      MonthEndPolicy policy = MonthEndPolicy::CLAMP);
+}
@@ -0,0 +1,158 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "DateTimeFormat.hpp"
+#include "TimestampParser.hpp"
+
+/** @file A scratch arena for batch conversions.
+
+    The batch functions in Ytime write to arrays provided by the caller
+    and never allocate. ConversionWorkspace provides those arrays, and
+    the text buffers and line splits that surround them, from a single
+    block that is kept between requests:
+
+    @code
+    workspace.reset();
+    auto lines = splitLines(request, workspace);
+    auto times = parseTimestamps(lines.data(), lines.size(), parser,
+                                 PackedDateTime(), workspace);
+    auto usecs = workspace.allocate<int64_t>(times.size());
+    toUnixTimeUsecs(times.data(), times.size(), usecs.data());
+    @endcode
+
+    Once the block has grown to the high-water mark of a request, later
+    requests of the same size or smaller don't allocate at all.
+*/
+
+namespace Ytime
+{
+    /**
+     * @brief An array allocated in a ConversionWorkspace. It is valid
+     *      until the workspace is reset or destroyed.
+     */
+    template <typename T>
+    class WorkspaceArray
+    {
+    public:
+        constexpr WorkspaceArray() noexcept = default;
+
+        constexpr WorkspaceArray(T* data, size_t size) noexcept
+            : m_Data(data), m_Size(size)
+        {}
+
+        constexpr T* data() const noexcept {return m_Data;}
+
+        constexpr size_t size() const noexcept {return m_Size;}
+
+        constexpr bool empty() const noexcept {return m_Size == 0;}
+
+        constexpr T* begin() const noexcept {return m_Data;}
+
+        constexpr T* end() const noexcept {return m_Data + m_Size;}
+
+        constexpr T& operator[](size_t i) const noexcept {return m_Data[i];}
+    private:
+        T* m_Data = nullptr;
+        size_t m_Size = 0;
+    };
+
+    class ConversionWorkspace
+    {
+    public:
+        ConversionWorkspace() noexcept;
+
+        explicit ConversionWorkspace(size_t capacity);
+
+        ConversionWorkspace(ConversionWorkspace&&) noexcept;
+
+        ~ConversionWorkspace();
+
+        ConversionWorkspace& operator=(ConversionWorkspace&&) noexcept;
+
+        /**
+         * @brief Makes all the memory available again, which invalidates
+         *      every array allocated since the previous reset.
+         *
+         * If the allocations since the previous reset didn't fit in the
+         * block, the block is replaced by one that is large enough for
+         * all of them.
+         */
+        void reset();
+
+        /**
+         * @brief Returns an array of @a count default-initialized values.
+         */
+        template <typename T>
+        WorkspaceArray<T> allocate(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>,
+                          "The workspace never calls destructors.");
+            static_assert(alignof(T) <= alignof(std::max_align_t));
+            auto ptr = static_cast<T*>(allocateBytes(count * sizeof(T),
+                                                     alignof(T)));
+            std::uninitialized_default_construct_n(ptr, count);
+            return {ptr, count};
+        }
+
+        /**
+         * @brief Returns the number of bytes that can be allocated between
+         *      two resets without allocating more memory.
+         */
+        size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns the number of bytes allocated since the last
+         *      reset.
+         */
+        size_t size() const noexcept;
+    private:
+        void* allocateBytes(size_t size, size_t alignment);
+
+        std::unique_ptr<std::byte[]> m_Block;
+        size_t m_Capacity = 0;
+        size_t m_Size = 0;
+        std::vector<std::unique_ptr<std::byte[]>> m_Overflow;
+    };
+
+    /**
+     * @brief Splits @a text into lines.
+     *
+     * Lines are separated by '\\n', and a trailing '\\r' is removed from
+     * each line. A final line without a trailing '\\n' is included if
+     * it isn't empty.
+     */
+    WorkspaceArray<std::string_view>
+    splitLines(std::string_view text, ConversionWorkspace& workspace);
+
+    /**
+     * @brief Parses @a values with @a parser. Values that can't be parsed
+     *      are set to @a invalidValue.
+     */
+    WorkspaceArray<PackedDateTime>
+    parseTimestamps(const std::string_view* values, size_t count,
+                    const TimestampParser& parser,
+                    PackedDateTime invalidValue,
+                    ConversionWorkspace& workspace);
+
+    /**
+     * @brief Formats @a values with @a format, each followed by
+     *      @a separator.
+     *
+     * Values that don't fit in the format, e.g. years after 9999, are
+     * written as empty strings.
+     */
+    std::string_view
+    formatTimestamps(const PackedDateTime* values, size_t count,
+                     const DateTimeFormat& format, char separator,
+                     ConversionWorkspace& workspace);
+}
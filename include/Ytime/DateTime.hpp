@@ -9,6 +9,7 @@
 #include <iosfwd>
 #include <optional>
 #include <string>
+#include <utility>
 #include "Constants.hpp"
 
 namespace Ytime
@@ -26,6 +27,22 @@ namespace Ytime
         {}
     };
 
+    /**
+     * @brief An ISO 8601 week date. Weekday 1 is Monday and 7 is Sunday.
+     */
+    struct DateYWD
+    {
+        int year, week, weekday;
+
+        constexpr DateYWD() noexcept
+            : year(), week(), weekday()
+        {}
+
+        constexpr DateYWD(int year, int week, int weekday) noexcept
+            : year(year), week(week), weekday(weekday)
+        {}
+    };
+
     struct Date
     {
         int year, month, day;
@@ -53,6 +70,27 @@ namespace Ytime
 
     std::ostream& operator<<(std::ostream& os, const Date& ymd);
 
+    constexpr bool isLeapYear(int year) noexcept
+    {
+        return (year % 16 == 0) || (year % 4 == 0 && year % 25 != 0);
+    }
+
+    /**
+     * @brief Returns the number of days in @a month, or 0 if @a month
+     *      isn't between 1 and 12.
+     */
+    constexpr int getDaysInMonth(int year, int month) noexcept
+    {
+        constexpr int DAYS[12] = {
+            31, 0, 31, 30, 31, 30,
+            31, 31, 30, 31, 30, 31};
+        if (month < 1 || 12 < month)
+            return 0;
+        if (month != 2)
+            return DAYS[month - 1];
+        return isLeapYear(year) ? 29 : 28;
+    }
+
     struct Time
     {
         int hour, minute, second, usecond;
@@ -114,17 +152,54 @@ namespace Ytime
 
     std::optional<Time> parseTime(std::string_view str);
 
+    /**
+     * @brief Parses an ISO 8601 date, time or date and time.
+     *
+     * Date and time can be separated by 'T' or a space. Date-times can
+     * end with an RFC 3339 UTC offset ("Z", "+hh:mm" or "-hh:mm"), the
+     * result is then converted to UTC.
+     */
     std::optional<DateTime> parseDateTime(std::string_view str);
 
+    /**
+     * @brief Like parseDateTime, but also returns the UTC offset in
+     *      minutes that was in @a str.
+     *
+     * The DateTime is in UTC, add the offset to get the original local
+     * date and time.
+     */
+    std::optional<std::pair<DateTime, int>>
+    parseDateTimeAndOffset(std::string_view str);
+
     std::string validate(const Date& date);
 
     std::string validate(const Time& time, bool allowLeapSecond = false);
 
     std::string validate(const DateTime& dateTime);
 
+    /**
+     * @brief Returns true if @a date passes validate(), but without
+     *      producing an error message.
+     */
+    bool isValid(const Date& date) noexcept;
+
+    bool isValid(const Time& time, bool allowLeapSecond = false) noexcept;
+
+    bool isValid(const DateTime& dateTime) noexcept;
+
     DateTime getCurrentDateTime();
 
     DateYD toYearDay(const Date& date);
 
     Date toYearMonthDay(const DateYD& date);
+
+    /**
+     * @brief Returns the ISO 8601 day of the week, 1 is Monday and 7 is
+     *      Sunday.
+     */
+    int getWeekday(const Date& date);
+
+    DateYWD toYearWeekDay(const Date& date);
+
+    Date toYearMonthDay(const DateYWD& date);
 }
@@ -0,0 +1,503 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "PackedDateTime.hpp"
+
+/** @file Defines DateTimeFormat, a fixed-width date and time pattern that
+    is compiled once and then used to parse and format any number of
+    values.
+
+    The pattern language:
+
+    - YYYY  year (four digits)
+    - MM    month, or minute when it follows an hour field
+    - DD    day of month
+    - DDD   day of year (001-366)
+    - HH    hour (hh is accepted as well)
+    - mm    minute
+    - SS    second (ss is accepted as well)
+    - f...  fraction of a second, one to six digits
+    - \\c   the character c as a literal
+
+    All other characters are literals that must match exactly.
+
+    StaticDateTimeFormat specializes parse and format for a constexpr
+    DateTimeFormat at compile time.
+*/
+
+namespace Ytime
+{
+    enum class FormatField : uint8_t
+    {
+        LITERAL,
+        YEAR,
+        MONTH,
+        DAY,
+        DAY_OF_YEAR,
+        HOUR,
+        MINUTE,
+        SECOND,
+        FRACTION
+    };
+
+    struct FormatInstruction
+    {
+        FormatField field = FormatField::LITERAL;
+        uint8_t width = 0;
+        char literal = 0;
+    };
+
+    namespace Detail
+    {
+        inline constexpr int FORMAT_POWERS_OF_TEN[] = {
+            1, 10, 100, 1000, 10000, 100000, 1000000
+        };
+
+        /* Returns the value of the width digits at s, or -1 if one of
+           them isn't a digit. */
+        constexpr int readFormatDigits(const char* s, unsigned width) noexcept
+        {
+            int value = 0;
+            for (unsigned i = 0; i < width; ++i)
+            {
+                auto digit = unsigned(s[i]) - '0';
+                if (digit > 9)
+                    return -1;
+                value = value * 10 + int(digit);
+            }
+            return value;
+        }
+
+        /* Returns nullptr if value doesn't fit in width digits. */
+        constexpr char* writeFormatDigits(char* s, int value,
+                                          unsigned width) noexcept
+        {
+            if (value < 0 || FORMAT_POWERS_OF_TEN[width] <= value)
+                return nullptr;
+            for (auto p = s + width; p != s;)
+            {
+                *--p = char('0' + value % 10);
+                value /= 10;
+            }
+            return s + width;
+        }
+
+        constexpr void setFormatField(DateTime& dt, FormatInstruction instr,
+                                      int value) noexcept
+        {
+            switch (instr.field)
+            {
+            case FormatField::YEAR:
+                dt.date.year = value;
+                break;
+            case FormatField::MONTH:
+                dt.date.month = value;
+                break;
+            case FormatField::DAY:
+                dt.date.day = value;
+                break;
+            case FormatField::DAY_OF_YEAR:
+                dt.date.month = 1;
+                dt.date.day = value;
+                break;
+            case FormatField::HOUR:
+                dt.time.hour = value;
+                break;
+            case FormatField::MINUTE:
+                dt.time.minute = value;
+                break;
+            case FormatField::SECOND:
+                dt.time.second = value;
+                break;
+            case FormatField::FRACTION:
+                dt.time.usecond = value
+                                  * FORMAT_POWERS_OF_TEN[6 - instr.width];
+                break;
+            default:
+                break;
+            }
+        }
+
+        inline int getFormatField(const DateTime& dt,
+                                  FormatInstruction instr)
+        {
+            switch (instr.field)
+            {
+            case FormatField::YEAR:
+                return dt.date.year;
+            case FormatField::MONTH:
+                return dt.date.month;
+            case FormatField::DAY:
+                return dt.date.day;
+            case FormatField::DAY_OF_YEAR:
+                return toYearDay(dt.date).day;
+            case FormatField::HOUR:
+                return dt.time.hour;
+            case FormatField::MINUTE:
+                return dt.time.minute;
+            case FormatField::SECOND:
+                return dt.time.second;
+            case FormatField::FRACTION:
+                return dt.time.usecond / FORMAT_POWERS_OF_TEN[6 - instr.width];
+            default:
+                return 0;
+            }
+        }
+    }
+
+    class DateTimeFormat
+    {
+    public:
+        static constexpr size_t MAX_INSTRUCTIONS = 32;
+
+        /**
+         * @brief Compiles @a pattern.
+         *
+         * When the DateTimeFormat is declared constexpr the pattern is
+         * compiled by the compiler, as is parseFields. parse and format
+         * interpret the compiled instructions at run time, use
+         * StaticDateTimeFormat to have them unrolled as well.
+         *
+         * @throw YtimeException if the pattern is invalid.
+         */
+        constexpr explicit DateTimeFormat(std::string_view pattern)
+        {
+            FormatField prevField = FormatField::LITERAL;
+            size_t i = 0;
+            while (i < pattern.size())
+            {
+                auto c = pattern[i];
+                auto n = countRepeats(pattern, i);
+                FormatInstruction instr;
+                switch (c)
+                {
+                case 'Y':
+                    if (n != 4)
+                        throw YtimeException("Year must be YYYY.");
+                    instr = {FormatField::YEAR, 4};
+                    break;
+                case 'M':
+                    if (n != 2)
+                        throw YtimeException("Month or minute must be MM.");
+                    if (prevField == FormatField::HOUR)
+                        instr = {FormatField::MINUTE, 2};
+                    else
+                        instr = {FormatField::MONTH, 2};
+                    break;
+                case 'D':
+                    if (n == 2)
+                        instr = {FormatField::DAY, 2};
+                    else if (n == 3)
+                        instr = {FormatField::DAY_OF_YEAR, 3};
+                    else
+                        throw YtimeException("Day must be DD or DDD.");
+                    break;
+                case 'H':
+                case 'h':
+                    if (n != 2)
+                        throw YtimeException("Hour must be HH.");
+                    instr = {FormatField::HOUR, 2};
+                    break;
+                case 'm':
+                    if (n != 2)
+                        throw YtimeException("Minute must be mm.");
+                    instr = {FormatField::MINUTE, 2};
+                    break;
+                case 'S':
+                case 's':
+                    if (n != 2)
+                        throw YtimeException("Second must be SS.");
+                    instr = {FormatField::SECOND, 2};
+                    break;
+                case 'f':
+                    if (n > 6)
+                        throw YtimeException("Fraction can have at most six digits.");
+                    instr = {FormatField::FRACTION, uint8_t(n)};
+                    break;
+                case '\\':
+                    if (i + 1 == pattern.size())
+                        throw YtimeException("Pattern ends with '\\'.");
+                    ++i;
+                    c = pattern[i];
+                    n = 1;
+                    [[fallthrough]];
+                default:
+                    instr = {FormatField::LITERAL, 1, c};
+                    n = 1;
+                    break;
+                }
+
+                if (m_Size == MAX_INSTRUCTIONS)
+                    throw YtimeException("Pattern is too long.");
+                m_Instructions[m_Size++] = instr;
+                m_Length += instr.width;
+                m_Fields |= 1u << unsigned(instr.field);
+                if (instr.field != FormatField::LITERAL)
+                    prevField = instr.field;
+                i += n;
+            }
+        }
+
+        /**
+         * @brief Returns the length of every string matched or produced by
+         *      this format.
+         */
+        constexpr size_t length() const noexcept
+        {
+            return m_Length;
+        }
+
+        constexpr const FormatInstruction* begin() const noexcept
+        {
+            return m_Instructions;
+        }
+
+        constexpr const FormatInstruction* end() const noexcept
+        {
+            return m_Instructions + m_Size;
+        }
+
+        /**
+         * @brief Extracts the fields in @a str without validating them.
+         *
+         * Fields that are not part of the pattern are zero, except for
+         * day-of-year which is returned as month 1 and the day of year
+         * as day.
+         */
+        constexpr std::optional<DateTime>
+        parseFields(std::string_view str) const noexcept
+        {
+            if (str.size() != m_Length)
+                return {};
+
+            DateTime dt;
+            const char* s = str.data();
+            for (auto& instr : *this)
+            {
+                if (instr.field == FormatField::LITERAL)
+                {
+                    if (*s++ != instr.literal)
+                        return {};
+                    continue;
+                }
+
+                auto value = Detail::readFormatDigits(s, instr.width);
+                if (value < 0)
+                    return {};
+                Detail::setFormatField(dt, instr, value);
+                s += instr.width;
+            }
+            return dt;
+        }
+
+        /**
+         * @brief Parses @a str and validates the result.
+         *
+         * If the pattern doesn't contain a year the date in the result is
+         * zero, as with Ytime::parseDateTime, and only the time is
+         * validated.
+         */
+        std::optional<DateTime> parseDateTime(std::string_view str) const noexcept;
+
+        /**
+         * @brief Validates @a fields as returned by parseFields, and
+         *      converts a day of year to month and day.
+         *
+         * parseDateTime is parseFields followed by validateFields.
+         */
+        std::optional<DateTime>
+        validateFields(const DateTime& fields) const noexcept;
+
+        /**
+         * @brief Parses @a str and returns the corresponding PackedDateTime.
+         *
+         * Returns an empty optional if @a str doesn't match the pattern,
+         * or the pattern doesn't contain a complete date.
+         */
+        std::optional<PackedDateTime> parse(std::string_view str) const noexcept;
+
+        /**
+         * @brief Writes @a dateTime to @a buffer.
+         *
+         * @return The number of characters written, i.e. length(), or 0 if
+         *      @a bufferSize is less than length() or a field has more
+         *      digits than the pattern allows, e.g. a year after 9999
+         *      with YYYY.
+         */
+        size_t format(const DateTime& dateTime,
+                      char* buffer, size_t bufferSize) const noexcept;
+
+        size_t format(PackedDateTime dateTime,
+                      char* buffer, size_t bufferSize) const noexcept;
+
+        /**
+         * @throw YtimeException if a field has more digits than the
+         *      pattern allows.
+         */
+        std::string format(PackedDateTime dateTime) const;
+
+        constexpr bool hasField(FormatField field) const noexcept
+        {
+            return (m_Fields & (1u << unsigned(field))) != 0;
+        }
+    private:
+        static constexpr size_t
+        countRepeats(std::string_view pattern, size_t pos) noexcept
+        {
+            auto end = pos + 1;
+            while (end < pattern.size() && pattern[end] == pattern[pos])
+                ++end;
+            return end - pos;
+        }
+
+        FormatInstruction m_Instructions[MAX_INSTRUCTIONS] = {};
+        uint8_t m_Size = 0;
+        uint8_t m_Length = 0;
+        uint16_t m_Fields = 0;
+    };
+
+    /**
+     * @brief The parse and format functions of DateTimeFormat,
+     *      specialized for a constant format.
+     *
+     * The instructions of @a Format are known at compile time, the loop
+     * over them is unrolled and every field is read or written at a
+     * fixed position with a fixed width. @a Format must be a constexpr
+     * DateTimeFormat with static storage duration:
+     *
+     * @code
+     * constexpr DateTimeFormat ISO("YYYY-MM-DDTHH:mm:SS");
+     * auto t = StaticDateTimeFormat<ISO>::parse("2024-03-05T12:00:00");
+     * @endcode
+     *
+     * The results are identical to those of the corresponding
+     * functions in DateTimeFormat.
+     */
+    template <const DateTimeFormat& Format>
+    class StaticDateTimeFormat
+    {
+    public:
+        static constexpr size_t length() noexcept
+        {
+            return Format.length();
+        }
+
+        static constexpr std::optional<DateTime>
+        parseFields(std::string_view str) noexcept
+        {
+            if (str.size() != Format.length())
+                return {};
+            DateTime dt;
+            if (!parseAll(str.data(), dt, Indexes()))
+                return {};
+            return dt;
+        }
+
+        static std::optional<DateTime>
+        parseDateTime(std::string_view str) noexcept
+        {
+            auto dt = parseFields(str);
+            if (!dt)
+                return {};
+            return Format.validateFields(*dt);
+        }
+
+        static std::optional<PackedDateTime>
+        parse(std::string_view str) noexcept
+        {
+            auto dt = parseDateTime(str);
+            if (!dt || dt->date.year == 0)
+                return {};
+            return pack(*dt);
+        }
+
+        static size_t format(const DateTime& dateTime,
+                             char* buffer, size_t bufferSize) noexcept
+        {
+            if (bufferSize < Format.length()
+                || !formatAll(buffer, dateTime, Indexes()))
+            {
+                return 0;
+            }
+            return Format.length();
+        }
+
+        static size_t format(PackedDateTime dateTime,
+                             char* buffer, size_t bufferSize) noexcept
+        {
+            return format(unpack(dateTime), buffer, bufferSize);
+        }
+    private:
+        using Indexes = std::make_index_sequence<
+            size_t(Format.end() - Format.begin())>;
+
+        /* Returns the position of instruction i in the string. */
+        static constexpr size_t offset(size_t i) noexcept
+        {
+            size_t result = 0;
+            for (size_t j = 0; j < i; ++j)
+                result += Format.begin()[j].width;
+            return result;
+        }
+
+        template <size_t... Is>
+        static constexpr bool parseAll(const char* s, DateTime& dt,
+                                       std::index_sequence<Is...>) noexcept
+        {
+            return (parseField<Is>(s, dt) && ...);
+        }
+
+        template <size_t I>
+        static constexpr bool parseField(const char* s, DateTime& dt) noexcept
+        {
+            constexpr auto instr = Format.begin()[I];
+            constexpr auto pos = offset(I);
+            if constexpr (instr.field == FormatField::LITERAL)
+            {
+                return s[pos] == instr.literal;
+            }
+            else
+            {
+                auto value = Detail::readFormatDigits(s + pos, instr.width);
+                if (value < 0)
+                    return false;
+                Detail::setFormatField(dt, instr, value);
+                return true;
+            }
+        }
+
+        template <size_t... Is>
+        static bool formatAll(char* s, const DateTime& dt,
+                              std::index_sequence<Is...>) noexcept
+        {
+            return (formatField<Is>(s, dt) && ...);
+        }
+
+        template <size_t I>
+        static bool formatField(char* s, const DateTime& dt) noexcept
+        {
+            constexpr auto instr = Format.begin()[I];
+            constexpr auto pos = offset(I);
+            if constexpr (instr.field == FormatField::LITERAL)
+            {
+                s[pos] = instr.literal;
+                return true;
+            }
+            else
+            {
+                auto value = Detail::getFormatField(dt, instr);
+                return Detail::writeFormatDigits(s + pos, value, instr.width)
+                       != nullptr;
+            }
+        }
+    };
+}
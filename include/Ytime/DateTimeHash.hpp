@@ -0,0 +1,112 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <functional>
+#include "PackedDateTime.hpp"
+
+/** @file Hash functions for Date, Time, DateTime and PackedDateTime,
+    and the corresponding specializations of std::hash.
+
+    Consecutive timestamps differ only in their lowest bits, the values
+    are therefore mixed so that every bit of the input affects every bit
+    of the hash. This makes them suitable for hash tables with a power
+    of two number of buckets.
+*/
+
+namespace Ytime
+{
+    /**
+     * @brief Returns @a value with its bits mixed (the finalizer from
+     *      SplitMix64).
+     */
+    constexpr uint64_t mixHash(uint64_t value) noexcept
+    {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    namespace Detail
+    {
+        constexpr uint64_t dateKey(const Date& d) noexcept
+        {
+            return (uint64_t(uint32_t(d.year)) << 32)
+                   ^ (uint64_t(uint32_t(d.month)) << 16)
+                   ^ uint64_t(uint32_t(d.day));
+        }
+
+        constexpr uint64_t timeKey(const Time& t) noexcept
+        {
+            return (uint64_t(uint32_t(t.hour)) << 48)
+                   ^ (uint64_t(uint32_t(t.minute)) << 40)
+                   ^ (uint64_t(uint32_t(t.second)) << 32)
+                   ^ uint64_t(uint32_t(t.usecond));
+        }
+    }
+
+    constexpr uint64_t hashValue(const Date& date) noexcept
+    {
+        return mixHash(Detail::dateKey(date));
+    }
+
+    constexpr uint64_t hashValue(const Time& time) noexcept
+    {
+        return mixHash(Detail::timeKey(time));
+    }
+
+    constexpr uint64_t hashValue(const DateTime& dateTime) noexcept
+    {
+        return mixHash(hashValue(dateTime.date)
+                       ^ Detail::timeKey(dateTime.time));
+    }
+
+    constexpr uint64_t hashValue(PackedDateTime dateTime) noexcept
+    {
+        return mixHash(uint64_t(dateTime));
+    }
+}
+
+namespace std
+{
+    template <>
+    struct hash<Ytime::Date>
+    {
+        size_t operator()(const Ytime::Date& date) const noexcept
+        {
+            return size_t(Ytime::hashValue(date));
+        }
+    };
+
+    template <>
+    struct hash<Ytime::Time>
+    {
+        size_t operator()(const Ytime::Time& time) const noexcept
+        {
+            return size_t(Ytime::hashValue(time));
+        }
+    };
+
+    template <>
+    struct hash<Ytime::DateTime>
+    {
+        size_t operator()(const Ytime::DateTime& dateTime) const noexcept
+        {
+            return size_t(Ytime::hashValue(dateTime));
+        }
+    };
+
+    template <>
+    struct hash<Ytime::PackedDateTime>
+    {
+        size_t operator()(Ytime::PackedDateTime dateTime) const noexcept
+        {
+            return size_t(Ytime::hashValue(dateTime));
+        }
+    };
+}
@@ -0,0 +1,192 @@
+//****************************************************************************
+// Copyright © 2020 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2020-04-23.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <tuple>
+#include "InternalDateTimeMath.hpp"
+
+namespace Ytime
+{
+    namespace Detail
+    {
+        using LeapSecond = std::tuple<PackedDateTime, uint32_t, uint32_t>;
+
+        constexpr LeapSecond
+        makeLeapSecondTuple(DateTime dateTime, uint32_t leapSecs) noexcept
+        {
+            return {
+                packInternalDateTime(dateTime),
+                daysSinceEpochYMD(dateTime.date),
+                leapSecs
+            };
+        }
+
+        /* Each entry is the first instant after a leap second as a
+           PackedDateTime, the day number of that instant and the accumulated
+           number of leap seconds from then on. */
+        inline constexpr LeapSecond LEAP_SECONDS[] = {
+            makeLeapSecondTuple({{1972, 7, 1}, {0, 0, 1}}, 1),
+            makeLeapSecondTuple({{1973, 1, 1}, {0, 0, 2}}, 2),
+            makeLeapSecondTuple({{1974, 1, 1}, {0, 0, 3}}, 3),
+            makeLeapSecondTuple({{1975, 1, 1}, {0, 0, 4}}, 4),
+            makeLeapSecondTuple({{1976, 1, 1}, {0, 0, 5}}, 5),
+            makeLeapSecondTuple({{1977, 1, 1}, {0, 0, 6}}, 6),
+            makeLeapSecondTuple({{1978, 1, 1}, {0, 0, 7}}, 7),
+            makeLeapSecondTuple({{1979, 1, 1}, {0, 0, 8}}, 8),
+            makeLeapSecondTuple({{1980, 1, 1}, {0, 0, 9}}, 9),
+            makeLeapSecondTuple({{1981, 7, 1}, {0, 0, 10}}, 10),
+            makeLeapSecondTuple({{1982, 7, 1}, {0, 0, 11}}, 11),
+            makeLeapSecondTuple({{1983, 7, 1}, {0, 0, 12}}, 12),
+            makeLeapSecondTuple({{1985, 7, 1}, {0, 0, 13}}, 13),
+            makeLeapSecondTuple({{1988, 1, 1}, {0, 0, 14}}, 14),
+            makeLeapSecondTuple({{1990, 1, 1}, {0, 0, 15}}, 15),
+            makeLeapSecondTuple({{1991, 1, 1}, {0, 0, 16}}, 16),
+            makeLeapSecondTuple({{1992, 7, 1}, {0, 0, 17}}, 17),
+            makeLeapSecondTuple({{1993, 7, 1}, {0, 0, 18}}, 18),
+            makeLeapSecondTuple({{1994, 7, 1}, {0, 0, 19}}, 19),
+            makeLeapSecondTuple({{1996, 1, 1}, {0, 0, 20}}, 20),
+            makeLeapSecondTuple({{1997, 7, 1}, {0, 0, 21}}, 21),
+            makeLeapSecondTuple({{1999, 1, 1}, {0, 0, 22}}, 22),
+            makeLeapSecondTuple({{2006, 1, 1}, {0, 0, 23}}, 23),
+            makeLeapSecondTuple({{2009, 1, 1}, {0, 0, 24}}, 24),
+            makeLeapSecondTuple({{2012, 7, 1}, {0, 0, 25}}, 25),
+            makeLeapSecondTuple({{2015, 7, 1}, {0, 0, 26}}, 26),
+            makeLeapSecondTuple({{2017, 1, 1}, {0, 0, 27}}, 27)
+        };
+
+        /* A leap second table. The built-in table is made from
+           LEAP_SECONDS, others are loaded from leap-seconds.list files. */
+        struct LeapSecondData
+        {
+            const LeapSecond* entries;
+            /* The first element of each entry as an integer. */
+            const int64_t* packedBounds;
+            /* The Unix time in microseconds of the day of each entry. */
+            const int64_t* unixBounds;
+            size_t size;
+            /* The day the table expires, 0 if it is unknown. */
+            uint32_t expirationDay;
+        };
+
+        constexpr size_t BUILT_IN_LEAP_SECOND_COUNT = std::size(LEAP_SECONDS);
+
+        using BuiltInLeapSecondBounds = std::array<int64_t, BUILT_IN_LEAP_SECOND_COUNT>;
+
+        constexpr BuiltInLeapSecondBounds makeBuiltInPackedBounds() noexcept
+        {
+            BuiltInLeapSecondBounds result = {};
+            for (size_t i = 0; i < BUILT_IN_LEAP_SECOND_COUNT; ++i)
+                result[i] = int64_t(std::get<0>(LEAP_SECONDS[i]));
+            return result;
+        }
+
+        constexpr BuiltInLeapSecondBounds makeBuiltInUnixBounds() noexcept
+        {
+            BuiltInLeapSecondBounds result = {};
+            for (size_t i = 0; i < BUILT_IN_LEAP_SECOND_COUNT; ++i)
+            {
+                auto days = int64_t(std::get<1>(LEAP_SECONDS[i]));
+                result[i] = (days - int64_t(UNIX_EPOCH_DAYS))
+                            * int64_t(USECS_PER_DAY);
+            }
+            return result;
+        }
+
+        inline constexpr BuiltInLeapSecondBounds BUILT_IN_PACKED_BOUNDS =
+            makeBuiltInPackedBounds();
+
+        inline constexpr BuiltInLeapSecondBounds BUILT_IN_UNIX_BOUNDS =
+            makeBuiltInUnixBounds();
+
+        inline constexpr LeapSecondData BUILT_IN_LEAP_SECOND_DATA = {
+            LEAP_SECONDS,
+            BUILT_IN_PACKED_BOUNDS.data(),
+            BUILT_IN_UNIX_BOUNDS.data(),
+            BUILT_IN_LEAP_SECOND_COUNT,
+            0
+        };
+
+        /* Readers only do an acquire load of this pointer. Tables that are
+           replaced are kept for a grace period of one minute before they
+           are freed (see LeapSecondList.cpp), so there is no need to track
+           when readers are done with them. The pointer is defined in the
+           header so the lookups can be inlined (see YTIME_HEADER_ONLY). */
+        inline std::atomic<const LeapSecondData*> g_LeapSecondData{
+            &BUILT_IN_LEAP_SECOND_DATA};
+
+        /* Returns the current leap second table. The reference remains
+           valid for at least a minute after a new table is published, it
+           must only be used for the duration of a single operation. */
+        inline const LeapSecondData& getLeapSecondData() noexcept
+        {
+            return *g_LeapSecondData.load(std::memory_order_acquire);
+        }
+
+        inline const LeapSecondData& getBuiltInLeapSecondData() noexcept
+        {
+            return BUILT_IN_LEAP_SECOND_DATA;
+        }
+
+        inline void publishLeapSecondData(const LeapSecondData& data) noexcept
+        {
+            g_LeapSecondData.store(&data, std::memory_order_release);
+        }
+
+        /* The lookups below take the table as an argument. An operation that
+           does more than one lookup must load the table once and pass it to
+           all of them, otherwise a table published in between could be mixed
+           with the old one. */
+
+        /* Returns the number of leap seconds accumulated before the start of
+           the given day. */
+        inline uint32_t getLeapSecondsForDay(const LeapSecondData& table,
+                                             uint32_t day) noexcept
+        {
+            using std::get;
+            auto end = table.entries + table.size;
+            auto it = std::upper_bound(
+                table.entries, end, day,
+                [](uint32_t d, auto& entry) {return d < get<1>(entry);});
+            if (it == table.entries)
+                return 0;
+            return get<2>(*std::prev(it));
+        }
+
+        inline uint32_t getLeapSecondsForDay(uint32_t day) noexcept
+        {
+            return getLeapSecondsForDay(getLeapSecondData(), day);
+        }
+
+        /* Returns the number of leap seconds inserted at or before
+           dateTime. */
+        inline uint32_t getLeapSeconds(const LeapSecondData& table,
+                                       PackedDateTime dateTime) noexcept
+        {
+            auto end = table.packedBounds + table.size;
+            auto it = std::upper_bound(table.packedBounds, end,
+                                       int64_t(dateTime));
+            if (it == table.packedBounds)
+                return 0;
+            return std::get<2>(table.entries[it - table.packedBounds - 1]);
+        }
+
+        inline bool isLeapSecond(const LeapSecondData& table,
+                                 PackedDateTime dateTime) noexcept
+        {
+            auto end = table.packedBounds + table.size;
+            auto it = std::lower_bound(table.packedBounds, end,
+                                       int64_t(dateTime));
+            if (it == end)
+                return false;
+            return int64_t(dateTime) < *it
+                   && int64_t(dateTime + USECS_PER_SEC) >= *it;
+        }
+    }
+}
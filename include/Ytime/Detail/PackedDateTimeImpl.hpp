@@ -0,0 +1,116 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+/* The definitions of the core conversion functions. With
+   YTIME_HEADER_ONLY this file is included at the end of
+   PackedDateTime.hpp and the functions are inline, otherwise it is only
+   included by PackedDateTime.cpp. */
+
+#include "Ytime/LeapSeconds.hpp"
+#include "InternalDateTimeMath.hpp"
+#include "LeapSecondTable.hpp"
+
+/* The instrumentation counters are only updated by the out-of-line
+   definitions. */
+#ifdef YTIME_HEADER_ONLY
+    #define YTIME_IMPL_COUNT(name) ((void)0)
+#else
+    #define YTIME_IMPL_COUNT(name) YTIME_COUNT(name)
+#endif
+
+namespace Ytime
+{
+    namespace Detail
+    {
+        YTIME_INLINE Date toYMD(uint64_t daysSinceEpoch) noexcept
+        {
+            auto[year, dayOfYear] = toInternalYD(uint32_t(daysSinceEpoch));
+            auto it = std::upper_bound(std::begin(ACCUMULATED_DAYS),
+                                       std::end(ACCUMULATED_DAYS),
+                                       dayOfYear);
+            auto month = std::distance(std::begin(ACCUMULATED_DAYS), it);
+            auto dayOfMonth = dayOfYear - ACCUMULATED_DAYS[month - 1] + 1;
+            if (month > 10)
+            {
+                month -= 10;
+                ++year;
+            }
+            else
+            {
+                month += 2;
+            }
+            return {int(year), int(month), int(dayOfMonth)};
+        }
+
+        YTIME_INLINE std::pair<uint64_t, uint64_t>
+        unpackDaysUsecondsUtc(const LeapSecondData& table,
+                              PackedDateTime dateTime) noexcept
+        {
+            YTIME_IMPL_COUNT(calls);
+            auto leapsecs = getLeapSeconds(table, dateTime);
+            auto secs = PackedDateTime(dateTime - leapsecs * USECS_PER_SEC);
+            auto dayUsecs = unpackDaysUseconds(secs);
+            if (isLeapSecond(table, dateTime))
+            {
+                YTIME_IMPL_COUNT(leapSecondHits);
+                --dayUsecs.first;
+                dayUsecs.second += USECS_PER_DAY;
+            }
+            return dayUsecs;
+        }
+
+        YTIME_INLINE std::pair<uint64_t, uint64_t>
+        unpackDaysUsecondsUtc(PackedDateTime dateTime) noexcept
+        {
+            return unpackDaysUsecondsUtc(getLeapSecondData(), dateTime);
+        }
+    }
+
+    YTIME_INLINE uint32_t getLeapSeconds(PackedDateTime dateTime) noexcept
+    {
+        return Detail::getLeapSeconds(Detail::getLeapSecondData(), dateTime);
+    }
+
+    YTIME_INLINE bool isLeapSecond(PackedDateTime dateTime) noexcept
+    {
+        return Detail::isLeapSecond(Detail::getLeapSecondData(), dateTime);
+    }
+
+    YTIME_INLINE uint32_t getLeapSeconds(Date date) noexcept
+    {
+        return Detail::getLeapSecondsForDay(Detail::daysSinceEpochYMD(date));
+    }
+
+    YTIME_INLINE PackedDateTime pack(const DateTime& dateTime) noexcept
+    {
+        auto days = Detail::daysSinceEpochYMD(dateTime.date);
+        auto usecs = Detail::usecsSinceMidnight(dateTime.time);
+        return PackedDateTime(Detail::packDaysUseconds(days, usecs)
+                              + getLeapSeconds(dateTime.date) * USECS_PER_SEC);
+    }
+
+    YTIME_INLINE DateTime unpack(PackedDateTime dateTime) noexcept
+    {
+        auto daysUsecs = Detail::unpackDaysUsecondsUtc(dateTime);
+        return {Detail::toYMD(daysUsecs.first),
+                Detail::toHMS(daysUsecs.second)};
+    }
+
+    YTIME_INLINE Date unpackDate(PackedDateTime dateTime) noexcept
+    {
+        return Detail::toYMD(Detail::unpackDaysUsecondsUtc(dateTime).first);
+    }
+
+    YTIME_INLINE Time unpackTime(PackedDateTime dateTime) noexcept
+    {
+        return Detail::toHMS(Detail::unpackDaysUsecondsUtc(dateTime).second);
+    }
+}
+
+#undef YTIME_IMPL_COUNT
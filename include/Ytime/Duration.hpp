@@ -0,0 +1,301 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include "DateTimeDelta.hpp"
+
+/** @file Parsing and formatting of ISO 8601 durations, e.g. P3DT4H30M
+    and PT0.25S.
+
+    Weeks and days become the days of the DateTimeDelta, hours, minutes
+    and seconds its microseconds. Years and months are rejected, they
+    have no fixed length (see CalendarDelta).
+
+    Everything here is constexpr and allocation-free:
+    @code
+    constexpr auto TIMEOUT = *Ytime::parseDuration("PT2M30S");
+    @endcode
+*/
+
+namespace Ytime
+{
+    namespace Detail
+    {
+        constexpr bool isDigit(char c) noexcept
+        {
+            return '0' <= c && c <= '9';
+        }
+
+        /* Adds a * b to sum. All values are non-negative. */
+        constexpr bool
+        addProduct(uint64_t& sum, uint64_t a, uint64_t b) noexcept
+        {
+            constexpr uint64_t MAX = INT64_MAX;
+            if (b != 0 && a > MAX / b)
+                return false;
+            if (a * b > MAX - sum)
+                return false;
+            sum += a * b;
+            return true;
+        }
+
+        constexpr uint64_t getDurationUnit(char designator, bool time) noexcept
+        {
+            if (!time)
+            {
+                switch (designator)
+                {
+                case 'W': return 7;
+                case 'D': return 1;
+                default: return 0;
+                }
+            }
+            switch (designator)
+            {
+            case 'H': return USECS_PER_HOUR;
+            case 'M': return USECS_PER_MIN;
+            case 'S': return USECS_PER_SEC;
+            default: return 0;
+            }
+        }
+
+        constexpr int getDurationRank(char designator, bool time) noexcept
+        {
+            if (!time)
+                return designator == 'W' ? 1 : 2;
+            switch (designator)
+            {
+            case 'H': return 3;
+            case 'M': return 4;
+            default: return 5;
+            }
+        }
+
+        constexpr size_t writeUnsigned(uint64_t value, char* buffer) noexcept
+        {
+            char digits[20] = {};
+            size_t n = 0;
+            do
+            {
+                digits[n++] = char('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            for (size_t i = 0; i < n; ++i)
+                buffer[i] = digits[n - 1 - i];
+            return n;
+        }
+
+        constexpr size_t writeString(const char* str, char* buffer) noexcept
+        {
+            size_t n = 0;
+            for (; str[n] != 0; ++n)
+                buffer[n] = str[n];
+            return n;
+        }
+
+        constexpr uint64_t getMagnitude(int64_t value) noexcept
+        {
+            return value < 0 ? uint64_t(-(value + 1)) + 1 : uint64_t(value);
+        }
+    }
+
+    /**
+     * @brief The longest string toChars can produce.
+     */
+    constexpr size_t MAX_DURATION_LENGTH = 64;
+
+    /**
+     * @brief Parses an ISO 8601 duration like P2W, P3DT4H30M or PT0.25S.
+     *
+     * The last component can have a fraction, separated by '.' or ',',
+     * with at most nine digits. Fractions of a microsecond are truncated.
+     * A leading '-' negates the whole duration, a '-' in front of a
+     * number negates only that component (this is not part of ISO 8601,
+     * but toChars produces it when days and microseconds have different
+     * signs).
+     *
+     * Returns an empty optional if @a str isn't a valid duration, it has
+     * years or months, or the result doesn't fit in a DateTimeDelta.
+     */
+    constexpr std::optional<DateTimeDelta>
+    parseDuration(std::string_view str) noexcept
+    {
+        size_t i = 0;
+        bool negative = false;
+        if (i < str.size() && (str[i] == '-' || str[i] == '+'))
+            negative = str[i++] == '-';
+        if (i == str.size() || str[i++] != 'P')
+            return {};
+
+        /* Positive and negative sums of days and microseconds. */
+        uint64_t sums[2][2] = {};
+        bool time = false;
+        bool hasComponent = false;
+        bool hasFraction = false;
+        int prevRank = 0;
+        while (i < str.size())
+        {
+            if (str[i] == 'T')
+            {
+                if (time || ++i == str.size())
+                    return {};
+                time = true;
+                continue;
+            }
+
+            /* A fraction must be on the last component. */
+            if (hasFraction)
+                return {};
+
+            bool negativeComponent = false;
+            if (str[i] == '-')
+            {
+                negativeComponent = true;
+                ++i;
+            }
+
+            uint64_t value = 0;
+            auto start = i;
+            for (; i < str.size() && Detail::isDigit(str[i]); ++i)
+            {
+                if (!Detail::addProduct(value, value, 9)
+                    || !Detail::addProduct(value, uint64_t(str[i] - '0'), 1))
+                {
+                    return {};
+                }
+            }
+            if (i == start || i == str.size())
+                return {};
+
+            /* The fraction in units of 10^-9. */
+            uint64_t fraction = 0;
+            if (str[i] == '.' || str[i] == ',')
+            {
+                hasFraction = true;
+                start = ++i;
+                for (; i < str.size() && Detail::isDigit(str[i]); ++i)
+                    fraction = fraction * 10 + uint64_t(str[i] - '0');
+                if (i == start || i - start > 9 || i == str.size())
+                    return {};
+                for (auto k = i - start; k < 9; ++k)
+                    fraction *= 10;
+            }
+
+            auto designator = str[i++];
+            auto unit = Detail::getDurationUnit(designator, time);
+            if (unit == 0)
+                return {};
+            auto rank = Detail::getDurationRank(designator, time);
+            if (rank <= prevRank)
+                return {};
+            prevRank = rank;
+            hasComponent = true;
+
+            /* Fractions of weeks and days are turned into microseconds.
+               The fraction is split in two to avoid overflow. */
+            auto unitUsecs = time ? unit : unit * USECS_PER_DAY;
+            auto high = fraction / 1000 * unitUsecs;
+            auto low = fraction % 1000 * unitUsecs;
+            auto fractionUsecs = high / 1000000
+                                 + (high % 1000000 * 1000 + low) / 1000000000;
+
+            auto& sum = sums[negative != negativeComponent ? 1 : 0];
+            if (!Detail::addProduct(sum[time ? 1 : 0], value, unit)
+                || !Detail::addProduct(sum[1], fractionUsecs, 1))
+            {
+                return {};
+            }
+        }
+
+        if (!hasComponent)
+            return {};
+
+        return DateTimeDelta(int64_t(sums[0][0]) - int64_t(sums[1][0]),
+                             int64_t(sums[0][1]) - int64_t(sums[1][1]));
+    }
+
+    /**
+     * @brief Writes @a delta to @a buffer as an ISO 8601 duration, e.g.
+     *      P3DT4H30M or PT0.25S.
+     *
+     * Days are written as days, microseconds as hours, minutes and
+     * seconds. A zero duration is PT0S. If both days and microseconds are
+     * negative the duration starts with '-', if they have different
+     * signs the negative component is written with a '-' in front of its
+     * number.
+     *
+     * @return The number of characters written, or 0 if @a bufferSize is
+     *      too small. MAX_DURATION_LENGTH is always large enough.
+     */
+    constexpr size_t
+    toChars(const DateTimeDelta& delta, char* buffer, size_t bufferSize) noexcept
+    {
+        char tmp[MAX_DURATION_LENGTH] = {};
+        size_t n = 0;
+
+        auto days = delta.days();
+        auto usecs = delta.totalUseconds();
+        bool negative = (days < 0 || usecs < 0) && days <= 0 && usecs <= 0;
+        if (negative)
+            tmp[n++] = '-';
+        tmp[n++] = 'P';
+
+        if (days != 0)
+        {
+            if (days < 0 && !negative)
+                tmp[n++] = '-';
+            n += Detail::writeUnsigned(Detail::getMagnitude(days), tmp + n);
+            tmp[n++] = 'D';
+        }
+
+        if (usecs != 0 || days == 0)
+        {
+            tmp[n++] = 'T';
+            /* Each time component needs its own sign. */
+            auto sign = usecs < 0 && !negative ? "-" : "";
+            auto rest = Detail::getMagnitude(usecs);
+            if (auto hours = rest / USECS_PER_HOUR; hours != 0)
+            {
+                n += Detail::writeString(sign, tmp + n);
+                n += Detail::writeUnsigned(hours, tmp + n);
+                tmp[n++] = 'H';
+                rest %= USECS_PER_HOUR;
+            }
+            if (auto minutes = rest / USECS_PER_MIN; minutes != 0)
+            {
+                n += Detail::writeString(sign, tmp + n);
+                n += Detail::writeUnsigned(minutes, tmp + n);
+                tmp[n++] = 'M';
+                rest %= USECS_PER_MIN;
+            }
+            if (rest != 0 || usecs == 0)
+            {
+                n += Detail::writeString(sign, tmp + n);
+                n += Detail::writeUnsigned(rest / USECS_PER_SEC, tmp + n);
+                if (auto frac = rest % USECS_PER_SEC; frac != 0)
+                {
+                    tmp[n++] = '.';
+                    for (auto div = USECS_PER_SEC / 10; frac != 0; div /= 10)
+                    {
+                        tmp[n++] = char('0' + frac / div);
+                        frac %= div;
+                    }
+                }
+                tmp[n++] = 'S';
+            }
+        }
+
+        if (bufferSize < n)
+            return 0;
+        for (size_t i = 0; i < n; ++i)
+            buffer[i] = tmp[i];
+        return n;
+    }
+}
@@ -0,0 +1,59 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include "PackedDateTime.hpp"
+
+/** @file Conversions between PackedDateTime and GPS time.
+
+    GPS time counts seconds since 1980-01-06 00:00:00 UTC without leap
+    seconds, it is always 19 seconds behind TAI. As PackedDateTime
+    counts leap seconds too, the conversion is a constant offset.
+*/
+
+namespace Ytime
+{
+    constexpr int64_t USECS_PER_GPS_WEEK = 7 * int64_t(USECS_PER_DAY);
+
+    /**
+     * @brief A GPS week number (not wrapped at 1024) and the time of
+     *      week in microseconds.
+     */
+    struct GpsTime
+    {
+        int64_t week = 0;
+        int64_t usecs = 0;
+    };
+
+    constexpr bool operator==(const GpsTime& a, const GpsTime& b) noexcept
+    {
+        return a.week == b.week && a.usecs == b.usecs;
+    }
+
+    constexpr bool operator!=(const GpsTime& a, const GpsTime& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    /**
+     * @brief Returns the number of microseconds since the GPS epoch.
+     */
+    int64_t toGpsTimeUsecs(PackedDateTime dateTime) noexcept;
+
+    PackedDateTime fromGpsTimeUsecs(int64_t usecs) noexcept;
+
+    GpsTime toGpsTime(PackedDateTime dateTime) noexcept;
+
+    PackedDateTime fromGpsTime(const GpsTime& gpsTime) noexcept;
+
+    void toGpsTimeUsecs(const PackedDateTime* values, size_t count,
+                        int64_t* result) noexcept;
+
+    void fromGpsTimeUsecs(const int64_t* values, size_t count,
+                          PackedDateTime* result) noexcept;
+}
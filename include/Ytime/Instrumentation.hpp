@@ -0,0 +1,84 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+
+/** @file Counters that show how often Ytime takes its slow paths.
+
+    The counters are only updated when Ytime is built with the CMake
+    option YTIME_ENABLE_INSTRUMENTATION. Otherwise the functions in this
+    file are still available, but all counters remain zero and the
+    instrumented functions are exactly as they would be without it.
+
+    Each thread updates its own cache-line aligned counters, and nothing
+    is shared between threads until the counters are read.
+*/
+
+namespace Ytime
+{
+    struct InstrumentationCounters
+    {
+        /** Calls to the instrumented scalar functions: add,
+            getDateTimeDelta, parseDateTime and the functions that unpack
+            a PackedDateTime. */
+        uint64_t calls = 0;
+        /** Calls and batch blocks that had to take the slower general
+            path, e.g. adding days rather than microseconds, or a batch
+            block that spans a leap second. */
+        uint64_t slowPaths = 0;
+        /** Values that were a leap second or needed adjusting because
+            of one. */
+        uint64_t leapSecondHits = 0;
+        uint64_t parseFailures = 0;
+        /** Exceptions thrown by Ytime. */
+        uint64_t throws = 0;
+        uint64_t batchCalls = 0;
+        /** The total number of values passed to batch functions. */
+        uint64_t batchValues = 0;
+        /** The number of batch calls that were timed. */
+        uint64_t sampledBatches = 0;
+        /** The total time spent in the timed batch calls. */
+        uint64_t sampledBatchNsecs = 0;
+    };
+
+    InstrumentationCounters& operator+=(InstrumentationCounters& a,
+                                        const InstrumentationCounters& b) noexcept;
+
+    InstrumentationCounters operator+(InstrumentationCounters a,
+                                      const InstrumentationCounters& b) noexcept;
+
+    InstrumentationCounters operator-(InstrumentationCounters a,
+                                      const InstrumentationCounters& b) noexcept;
+
+    /**
+     * @brief Returns true if Ytime was built with instrumentation.
+     */
+    bool isInstrumentationEnabled() noexcept;
+
+    /**
+     * @brief Returns the sum of the counters of all threads, including
+     *      threads that have finished, since the last call to
+     *      resetInstrumentationCounters.
+     */
+    InstrumentationCounters getInstrumentationCounters();
+
+    /**
+     * @brief Returns the counters of the calling thread since it started.
+     *
+     * These counters are not affected by resetInstrumentationCounters.
+     */
+    InstrumentationCounters getThreadInstrumentationCounters() noexcept;
+
+    void resetInstrumentationCounters();
+
+    /**
+     * @brief Makes every @a interval'th batch call on each thread measure
+     *      its duration. 0 turns the timing off. The default is 64.
+     */
+    void setBatchSamplingInterval(uint32_t interval) noexcept;
+}
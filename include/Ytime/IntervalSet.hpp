@@ -0,0 +1,89 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <utility>
+#include <vector>
+#include "PackedDateTime.hpp"
+
+namespace Ytime
+{
+    using Interval = std::pair<PackedDateTime, PackedDateTime>;
+
+    /**
+     * @brief A set of half-open intervals [start, end) of PackedDateTime
+     *      values.
+     *
+     * The set is stored as a single sorted array of endpoints, where even
+     * indices are starts and odd indices are ends. Overlapping and
+     * adjacent intervals are always merged, and empty intervals are
+     * dropped.
+     */
+    class IntervalSet
+    {
+    public:
+        IntervalSet() = default;
+
+        /**
+         * @brief Creates a set from intervals in any order.
+         *
+         * The intervals are sorted and merged in the given vector, no
+         * other temporary memory is used.
+         */
+        explicit IntervalSet(std::vector<Interval> intervals);
+
+        IntervalSet(const Interval* intervals, size_t count);
+
+        bool empty() const noexcept;
+
+        /** @brief Returns the number of disjoint intervals. */
+        size_t size() const noexcept;
+
+        Interval operator[](size_t i) const noexcept;
+
+        const std::vector<PackedDateTime>& endpoints() const noexcept;
+
+        /** @brief Adds [start, end) to the set. This is O(n). */
+        void insert(PackedDateTime start, PackedDateTime end);
+
+        bool contains(PackedDateTime dateTime) const noexcept;
+
+        /**
+         * @brief Sets result[i] to contains(values[i]).
+         *
+         * Values that come after the previous value are found with an
+         * exponential search from the previous position, sorted queries
+         * are therefore done in a single pass.
+         */
+        void contains(const PackedDateTime* values, size_t count,
+                      bool* result) const noexcept;
+
+        /**
+         * @brief Returns the elapsed time covered by the set, including
+         *      any leap seconds, as microseconds.
+         */
+        DateTimeDelta totalDuration() const noexcept;
+
+        friend IntervalSet unite(const IntervalSet& a, const IntervalSet& b);
+
+        friend IntervalSet intersect(const IntervalSet& a, const IntervalSet& b);
+
+        friend IntervalSet subtract(const IntervalSet& a, const IntervalSet& b);
+    private:
+        std::vector<PackedDateTime> m_Endpoints;
+    };
+
+    bool operator==(const IntervalSet& a, const IntervalSet& b) noexcept;
+
+    bool operator!=(const IntervalSet& a, const IntervalSet& b) noexcept;
+
+    IntervalSet operator|(const IntervalSet& a, const IntervalSet& b);
+
+    IntervalSet operator&(const IntervalSet& a, const IntervalSet& b);
+
+    IntervalSet operator-(const IntervalSet& a, const IntervalSet& b);
+}
@@ -6,19 +6,68 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <optional>
+#include <string>
+#include <string_view>
 #include "PackedDateTime.hpp"
 
 namespace Ytime
 {
-    uint32_t getLeapSeconds(PackedDateTime dateTime) noexcept;
+    YTIME_INLINE uint32_t getLeapSeconds(PackedDateTime dateTime) noexcept;
 
-    bool isLeapSecond(PackedDateTime dateTime) noexcept;
+    YTIME_INLINE bool isLeapSecond(PackedDateTime dateTime) noexcept;
 
     uint32_t getLeapSeconds(DateTime dateTime) noexcept;
 
     bool isLeapSecond(DateTime dateTime) noexcept;
 
-    uint32_t getLeapSeconds(Date date) noexcept;
+    YTIME_INLINE uint32_t getLeapSeconds(Date date) noexcept;
 
     bool hasLeapSecond(Date date) noexcept;
+
+    /**
+     * @brief Replaces the leap second table with the one in @a text, the
+     *      contents of a leap-seconds.list file from IERS or NIST.
+     *
+     * The file's SHA-1 hash is verified, and the file must contain all
+     * the leap seconds built into the library. PackedDateTime values
+     * after a new leap second change meaning when the table is replaced,
+     * the table should therefore be loaded before such values are
+     * created.
+     *
+     * Threads that use the leap second functions while the table is
+     * replaced see either the old or the new table. The lookups never
+     * block, replaced tables are therefore kept in memory for a minute
+     * before they are freed. Loading a list that is identical to the
+     * current one has no effect.
+     *
+     * @throw YtimeException if the file is malformed, the hash doesn't
+     *      match or the file is missing built-in leap seconds.
+     */
+    void setLeapSecondList(std::string_view text);
+
+    /**
+     * @brief Reads a leap-seconds.list file and calls setLeapSecondList
+     *      with its contents.
+     *
+     * @throw YtimeException if the file can not be read.
+     */
+    void loadLeapSecondList(const std::string& path);
+
+    /**
+     * @brief Restores the leap second table built into the library.
+     */
+    void resetLeapSecondList() noexcept;
+
+    /**
+     * @brief Returns the expiration date of the current leap second
+     *      table, or nothing for the built-in table.
+     */
+    std::optional<Date> getLeapSecondListExpiration();
+
+    /**
+     * @brief Returns true if the current leap second table has an
+     *      expiration date and @a now is at or after it.
+     */
+    bool isLeapSecondListExpired(PackedDateTime now) noexcept;
 }
@@ -0,0 +1,80 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include "PackedDateTime.hpp"
+
+/** @file Conversions between PackedDateTime and smeared UTC.
+
+    Clocks that smear leap seconds have no 23:59:60, instead their
+    seconds are slightly longer during a window around each leap second.
+    Smeared time is represented as Unix time in microseconds, outside
+    the smear windows it is identical to toUnixTimeUsecs and
+    fromUnixTimeUsecs.
+
+    The batch functions convert blocks of values that lie outside every
+    smear window with the plain Unix time conversions, and only convert
+    values inside a window one by one.
+*/
+
+namespace Ytime
+{
+    enum class SmearShape
+    {
+        /** The clock runs at a constant slower rate during the window. */
+        LINEAR,
+        /** The rate changes gradually at the start and end of the
+            window. */
+        COSINE
+    };
+
+    struct LeapSmear
+    {
+        /** @brief The length of the window in smeared time. */
+        DateTimeDelta duration = Days(1);
+        /** @brief How long before the end of the leap second the window
+            starts, also in smeared time. */
+        DateTimeDelta lead = Seconds(12 * 3600);
+        SmearShape shape = SmearShape::LINEAR;
+    };
+
+    /**
+     * @throw YtimeException if the duration isn't positive, or the lead
+     *      is negative or greater than the duration.
+     */
+    int64_t toSmearedUnixTimeUsecs(PackedDateTime dateTime,
+                                   const LeapSmear& smear = {});
+
+    /**
+     * @throw YtimeException if the duration isn't positive, or the lead
+     *      is negative or greater than the duration.
+     */
+    PackedDateTime fromSmearedUnixTimeUsecs(int64_t usecs,
+                                            const LeapSmear& smear = {});
+
+    void toSmearedUnixTimeUsecs(const PackedDateTime* values, size_t count,
+                                int64_t* result,
+                                const LeapSmear& smear = {});
+
+    void fromSmearedUnixTimeUsecs(const int64_t* values, size_t count,
+                                  PackedDateTime* result,
+                                  const LeapSmear& smear = {});
+
+    /**
+     * @brief Packs a date and time read from a smeared clock.
+     */
+    PackedDateTime packSmeared(const DateTime& dateTime,
+                               const LeapSmear& smear = {});
+
+    /**
+     * @brief Returns the date and time a smeared clock shows at
+     *      @a dateTime. The result is never a leap second.
+     */
+    DateTime unpackSmeared(PackedDateTime dateTime,
+                           const LeapSmear& smear = {});
+}
@@ -15,6 +15,7 @@
 #include <utility>
 #include "DateTime.hpp"
 #include "DateTimeDelta.hpp"
+#include "YtimeConfig.hpp"
 #include "YtimeException.hpp"
 
 /** @file This file defines a memory efficient representation of
@@ -38,15 +39,25 @@ namespace Ytime
      * @brief Returns the PackedDateTime value for the given
      *      UTC date and time.
      */
-    PackedDateTime pack(const DateTime& dateTime) noexcept;
+    YTIME_INLINE PackedDateTime pack(const DateTime& dateTime) noexcept;
 
-    DateTime unpack(PackedDateTime dateTime) noexcept;
+    YTIME_INLINE DateTime unpack(PackedDateTime dateTime) noexcept;
 
-    Date unpackDate(PackedDateTime dateTime) noexcept;
+    YTIME_INLINE Date unpackDate(PackedDateTime dateTime) noexcept;
 
-    Time unpackTime(PackedDateTime dateTime) noexcept;
+    YTIME_INLINE Time unpackTime(PackedDateTime dateTime) noexcept;
+
+    /**
+     * @brief Returns the ISO 8601 day of the week, 1 is Monday and 7 is
+     *      Sunday.
+     */
+    int getWeekday(PackedDateTime dateTime) noexcept;
 
     DateTimeDelta getDateTimeDelta(PackedDateTime from, PackedDateTime to);
 
     PackedDateTime add(PackedDateTime from, DateTimeDelta delta);
 }
+
+#ifdef YTIME_HEADER_ONLY
+    #include "Detail/PackedDateTimeImpl.hpp"
+#endif
@@ -0,0 +1,272 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "PackedDateTime.hpp"
+
+namespace Ytime
+{
+    enum class Frequency
+    {
+        SECONDLY,
+        MINUTELY,
+        HOURLY,
+        DAILY,
+        WEEKLY,
+        MONTHLY,
+        YEARLY
+    };
+
+    class RecurrenceRule;
+
+    /**
+     * @brief Input iterator over the occurrences of a RecurrenceRule.
+     *
+     * A default-constructed iterator is the end iterator.
+     */
+    class RecurrenceIterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = PackedDateTime;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const PackedDateTime*;
+        using reference = const PackedDateTime&;
+
+        RecurrenceIterator() = default;
+
+        const PackedDateTime& operator*() const noexcept
+        {
+            return m_Value;
+        }
+
+        RecurrenceIterator& operator++();
+
+        RecurrenceIterator operator++(int);
+
+        friend bool operator==(const RecurrenceIterator& a,
+                               const RecurrenceIterator& b) noexcept
+        {
+            return a.m_Rule == b.m_Rule
+                   && (!a.m_Rule || a.m_Value == b.m_Value);
+        }
+
+        friend bool operator!=(const RecurrenceIterator& a,
+                               const RecurrenceIterator& b) noexcept
+        {
+            return !(a == b);
+        }
+    private:
+        friend class RecurrenceRule;
+
+        const RecurrenceRule* m_Rule = nullptr;
+        /* The copy of the rule made by RecurrenceRule::occurrences, it
+           keeps m_Rule alive for as long as there are iterators. */
+        std::shared_ptr<const RecurrenceRule> m_Owner;
+        PackedDateTime m_Value = {};
+        /* The occurrence as microseconds since the epoch without leap
+           seconds. */
+        int64_t m_Usecs = 0;
+        uint64_t m_Index = 0;
+        /* The period whose candidate days are in m_Days. Only used by
+           frequencies of a day or more. */
+        int64_t m_Period = -1;
+        std::vector<uint32_t> m_Days;
+    };
+
+    class RecurrenceRange
+    {
+    public:
+        RecurrenceRange(RecurrenceIterator first) noexcept
+            : m_First(std::move(first))
+        {}
+
+        RecurrenceIterator begin() const
+        {
+            return m_First;
+        }
+
+        RecurrenceIterator end() const noexcept
+        {
+            return {};
+        }
+    private:
+        RecurrenceIterator m_First;
+    };
+
+    /**
+     * @brief A recurrence rule modelled on the RRULE in RFC 5545.
+     *
+     * The BY-filters are compiled into bitmasks when they are set, and
+     * occurrences are computed on demand. Finding the first occurrence
+     * at or after a given time jumps directly to the right period, it
+     * doesn't iterate from the start (unless a count has been set).
+     *
+     * Occurrences are computed in UTC clock time and then packed, an
+     * HOURLY rule therefore gives 00:00:00 after a leap second, not
+     * 23:59:60. Leap seconds are never occurrences themselves.
+     *
+     * Following RFC 5545, WEEKLY, MONTHLY and YEARLY rules without any
+     * day filters use the weekday, day of month and month of the start.
+     * Weeks start on Monday. Occurrences before the start are never
+     * produced.
+     *
+     * If no occurrence is found within 400 years of where the search
+     * starts, the rule is considered to have no more occurrences.
+     *
+     * "The last business day of the month" is:
+     * @code
+     * RecurrenceRule(start, Frequency::MONTHLY)
+     *     .setWeekdays({1, 2, 3, 4, 5})
+     *     .setPositions({-1});
+     * @endcode
+     */
+    class RecurrenceRule
+    {
+    public:
+        /**
+         * @throw YtimeException if @a start is a leap second or
+         *      @a interval is 0.
+         */
+        RecurrenceRule(PackedDateTime start, Frequency frequency,
+                       uint32_t interval = 1);
+
+        PackedDateTime start() const noexcept;
+
+        Frequency frequency() const noexcept;
+
+        uint32_t interval() const noexcept;
+
+        /**
+         * @brief Limits the rule to @a count occurrences. 0 means no limit.
+         */
+        RecurrenceRule& setCount(uint64_t count);
+
+        /**
+         * @brief Limits the rule to occurrences at or before @a until.
+         */
+        RecurrenceRule& setUntil(PackedDateTime until);
+
+        /** @brief Months are 1 to 12. */
+        RecurrenceRule& setMonths(std::initializer_list<int> months);
+
+        /**
+         * @brief Days are 1 to 31 or -31 to -1, where -1 is the last day
+         *      of the month.
+         */
+        RecurrenceRule& setMonthDays(std::initializer_list<int> days);
+
+        /** @brief Weekdays are 1 (Monday) to 7 (Sunday). */
+        RecurrenceRule& setWeekdays(std::initializer_list<int> weekdays);
+
+        /**
+         * @brief Adds the @a n'th @a weekday of the month (MONTHLY, or
+         *      YEARLY with months) or year (YEARLY). Negative @a n counts
+         *      from the end, 0 means every such weekday.
+         *
+         * @throw YtimeException if @a n isn't 0 and the frequency is
+         *      neither MONTHLY nor YEARLY.
+         */
+        RecurrenceRule& addWeekday(int weekday, int n = 0);
+
+        /**
+         * @brief Hours are 0 to 23.
+         *
+         * Hours and minutes only apply to SECONDLY, MINUTELY and HOURLY
+         * rules, the other rules use the time of day of the start.
+         */
+        RecurrenceRule& setHours(std::initializer_list<int> hours);
+
+        /** @brief Minutes are 0 to 59. */
+        RecurrenceRule& setMinutes(std::initializer_list<int> minutes);
+
+        /**
+         * @brief Selects the @a n'th candidate day in each period, like
+         *      BYSETPOS. Negative positions count from the end.
+         *
+         * @throw YtimeException if the frequency is less than DAILY.
+         */
+        RecurrenceRule& setPositions(std::initializer_list<int> positions);
+
+        /**
+         * @brief Returns the occurrences of the rule.
+         *
+         * The range and its iterators share a copy of the rule, they
+         * remain valid after the rule is modified or destroyed, e.g.
+         * when the rule is a temporary:
+         * @code
+         * for (auto t : RecurrenceRule(start, Frequency::DAILY).occurrences())
+         * @endcode
+         */
+        RecurrenceRange occurrences() const;
+
+        /**
+         * @brief Returns the occurrences at or after @a from.
+         *
+         * The range shares a copy of the rule, as with occurrences().
+         */
+        RecurrenceRange occurrencesFrom(PackedDateTime from) const;
+
+        /**
+         * @brief Returns the first occurrence at or after @a from.
+         */
+        std::optional<PackedDateTime> next(PackedDateTime from) const;
+    private:
+        friend class RecurrenceIterator;
+
+        /* The iterators returned by these two refer to this rule, not
+           a copy. */
+        RecurrenceIterator makeIterator(int64_t minUsecs) const;
+
+        RecurrenceIterator makeIteratorFrom(PackedDateTime from) const;
+
+        bool advance(RecurrenceIterator& it, int64_t minUsecs) const;
+
+        bool advanceSubDaily(RecurrenceIterator& it, int64_t minUsecs) const;
+
+        bool advanceDaily(RecurrenceIterator& it, int64_t minUsecs) const;
+
+        int64_t getPeriod(uint32_t day) const noexcept;
+
+        std::pair<uint32_t, uint32_t> getPeriodDays(int64_t period) const;
+
+        void makeCandidates(int64_t period, std::vector<uint32_t>& days) const;
+
+        bool isMatchingDay(uint32_t day) const noexcept;
+
+        void updateDayFilter() noexcept;
+
+        PackedDateTime m_Start;
+        int64_t m_StartUsecs;
+        uint32_t m_StartDay;
+        Frequency m_Frequency;
+        uint32_t m_Interval;
+        uint64_t m_Count = 0;
+        int64_t m_UntilUsecs = INT64_MAX;
+
+        /* The filters as set by the user. Bit n corresponds to month n,
+           day n or hour n etc. Weekday bit 0 is Monday. */
+        uint16_t m_Months = 0;
+        uint32_t m_MonthDays = 0;
+        uint32_t m_NegativeMonthDays = 0;
+        uint8_t m_Weekdays = 0;
+        std::vector<std::pair<int, int>> m_NthWeekdays;
+        uint32_t m_Hours = 0;
+        uint64_t m_Minutes = 0;
+        std::vector<int> m_Positions;
+
+        /* The day filters with the defaults from the start applied. */
+        uint16_t m_DayMonths = 0;
+        uint32_t m_DayMonthDays = 0;
+        uint8_t m_DayWeekdays = 0;
+    };
+}
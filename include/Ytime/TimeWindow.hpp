@@ -0,0 +1,169 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "PackedDateTime.hpp"
+
+namespace Ytime
+{
+    struct WindowAggregate
+    {
+        uint64_t count = 0;
+        double sum = 0;
+    };
+
+    /**
+     * @brief Count and sum of the values inserted in the last @a width
+     *      of time, kept in a ring buffer of fixed capacity.
+     *
+     * Only one thread may call insert and advance, any number of threads
+     * may call aggregate and latest concurrently. Readers see the state
+     * as of the most recent insert or advance, published through a
+     * sequence lock without blocking the writer.
+     *
+     * The sum is updated incrementally, with floating point values it
+     * can therefore accumulate rounding errors over time.
+     */
+    class SlidingWindow
+    {
+    public:
+        /**
+         * @throw YtimeException if @a width isn't positive or
+         *      @a capacity is 0.
+         */
+        SlidingWindow(DateTimeDelta width, size_t capacity);
+
+        /**
+         * @brief Adds a value at @a time and evicts values that are no
+         *      longer inside the window.
+         *
+         * Times must be non-decreasing.
+         *
+         * @return false if the buffer is full or @a time is before the
+         *      latest time.
+         */
+        bool insert(PackedDateTime time, double value = 1);
+
+        /**
+         * @brief Moves the end of the window to @a now, evicting values
+         *      that are older than @a now - width.
+         */
+        void advance(PackedDateTime now);
+
+        WindowAggregate aggregate() const noexcept;
+
+        PackedDateTime latest() const noexcept;
+
+        size_t capacity() const noexcept;
+    private:
+        struct Event
+        {
+            PackedDateTime time;
+            double value;
+        };
+
+        void evict(PackedDateTime now) noexcept;
+
+        void publish() noexcept;
+
+        int64_t m_Width;
+        std::vector<Event> m_Events;
+        size_t m_Head = 0;
+        size_t m_Size = 0;
+        double m_Sum = 0;
+        PackedDateTime m_Latest = {};
+
+        std::atomic<uint64_t> m_Sequence{0};
+        std::atomic<uint64_t> m_PublishedCount{0};
+        std::atomic<double> m_PublishedSum{0};
+        std::atomic<uint64_t> m_PublishedLatest{0};
+    };
+
+    enum class CalendarUnit
+    {
+        MINUTE,
+        HOUR,
+        DAY,
+        MONTH,
+        YEAR
+    };
+
+    struct WindowBucket
+    {
+        PackedDateTime start;
+        PackedDateTime end;
+        WindowAggregate aggregate;
+    };
+
+    /**
+     * @brief Count and sum per calendar minute, hour, day, month or year
+     *      for the most recent @a bucketCount buckets.
+     *
+     * Bucket boundaries are UTC calendar boundaries, a leap second
+     * belongs to the bucket that contains 23:59:59. Inserting into the
+     * current bucket only compares the time with the bucket's
+     * boundaries. Moving to a new bucket doesn't touch the skipped
+     * buckets: each slot stores the key of its bucket, and a slot whose
+     * key doesn't match is read as an empty bucket.
+     *
+     * Only one thread may call insert, any number of threads may call
+     * bucket and current concurrently. Each bucket is published through
+     * its own sequence lock.
+     */
+    class TumblingWindow
+    {
+    public:
+        /**
+         * @throw YtimeException if @a bucketCount is 0.
+         */
+        TumblingWindow(CalendarUnit unit, size_t bucketCount);
+
+        /**
+         * @return false if @a time is in a bucket that has already been
+         *      discarded.
+         */
+        bool insert(PackedDateTime time, double value = 1);
+
+        /**
+         * @brief Returns the bucket that contains @a time, if it is still
+         *      in the buffer.
+         */
+        std::optional<WindowBucket> bucket(PackedDateTime time) const;
+
+        /**
+         * @brief Returns the most recent bucket, if any.
+         */
+        std::optional<WindowBucket> current() const;
+    private:
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence{0};
+            std::atomic<int64_t> key{INT64_MIN};
+            std::atomic<uint64_t> count{0};
+            std::atomic<double> sum{0};
+        };
+
+        int64_t getKey(PackedDateTime time) const noexcept;
+
+        PackedDateTime getStart(int64_t key) const noexcept;
+
+        std::optional<WindowBucket> readSlot(int64_t key) const;
+
+        void writeSlot(int64_t key, uint64_t count, double sum) noexcept;
+
+        CalendarUnit m_Unit;
+        size_t m_Size;
+        std::unique_ptr<Slot[]> m_Slots;
+        std::atomic<int64_t> m_NewestKey{INT64_MIN};
+        PackedDateTime m_CurrentStart = {};
+        PackedDateTime m_CurrentEnd = {};
+    };
+}
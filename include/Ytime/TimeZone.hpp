@@ -0,0 +1,139 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <atomic>
+#include <string>
+#include <vector>
+#include "PackedDateTime.hpp"
+
+namespace Ytime
+{
+    /**
+     * @brief Decides how TimeZone::toUtc handles local times that
+     *      occur twice or not at all because of a change of UTC offset.
+     */
+    enum class LocalTimePolicy
+    {
+        /** Use the UTC offset that was in effect before the change.
+            An ambiguous time gives the earlier UTC time, a
+            nonexistent time is moved forward by the size of the gap.
+          */
+        OFFSET_BEFORE_TRANSITION,
+        /** Use the UTC offset that is in effect after the change.
+            An ambiguous time gives the later UTC time, a nonexistent
+            time is moved backward by the size of the gap.
+          */
+        OFFSET_AFTER_TRANSITION,
+        /** Throw YtimeException. */
+        THROW
+    };
+
+    /**
+     * @brief A time zone compiled to a sorted array of the UTC instants
+     *      where the UTC offset changes.
+     *
+     * Each TimeZone remembers the interval of the most recent lookup,
+     * consecutive lookups in the same interval are therefore O(1).
+     * The batch functions are fastest on sorted input.
+     */
+    class TimeZone
+    {
+    public:
+        /**
+         * @brief Creates the UTC time zone.
+         */
+        TimeZone();
+
+        /**
+         * @brief Creates a time zone from a list of transitions.
+         *
+         * @param transitions The UTC instants where the offset changes,
+         *      must be sorted.
+         * @param offsets The UTC offsets in seconds. The first offset
+         *      applies before the first transition, offsets[i + 1]
+         *      applies from transitions[i]. Must have one more
+         *      element than @a transitions.
+         */
+        TimeZone(std::string name,
+                 const std::vector<PackedDateTime>& transitions,
+                 std::vector<int32_t> offsets);
+
+        TimeZone(const TimeZone& other);
+
+        TimeZone(TimeZone&& other) noexcept;
+
+        TimeZone& operator=(const TimeZone& other);
+
+        TimeZone& operator=(TimeZone&& other) noexcept;
+
+        const std::string& name() const noexcept;
+
+        /**
+         * @brief Returns the offset in seconds between UTC and local
+         *      time at @a utc.
+         */
+        int32_t getUtcOffset(PackedDateTime utc) const noexcept;
+
+        /**
+         * @brief Returns the local date and time at @a utc.
+         *
+         * A UTC leap second is second 60 in local time too.
+         */
+        DateTime toLocal(PackedDateTime utc) const noexcept;
+
+        PackedDateTime toUtc(const DateTime& local,
+                             LocalTimePolicy policy
+                                 = LocalTimePolicy::OFFSET_BEFORE_TRANSITION) const;
+
+        void getUtcOffsets(const PackedDateTime* utc, size_t count,
+                           int32_t* result) const noexcept;
+
+        void toLocal(const PackedDateTime* utc, size_t count,
+                     DateTime* result) const noexcept;
+
+        void toUtc(const DateTime* local, size_t count,
+                   PackedDateTime* result,
+                   LocalTimePolicy policy
+                       = LocalTimePolicy::OFFSET_BEFORE_TRANSITION) const;
+    private:
+        size_t findInterval(PackedDateTime utc, size_t hint) const noexcept;
+
+        size_t findInterval(PackedDateTime utc) const noexcept;
+
+        int64_t getUtcUsecs(int64_t localUsecs, size_t& hint,
+                            LocalTimePolicy policy) const;
+
+        std::string m_Name;
+        /* m_Starts[i] is the UTC instant where interval i starts,
+           m_Starts[0] is 0. */
+        std::vector<PackedDateTime> m_Starts;
+        std::vector<int32_t> m_Offsets;
+        /* The start of each interval as local Unix time in microseconds. */
+        std::vector<int64_t> m_LocalStarts;
+        mutable std::atomic<size_t> m_CachedInterval = 0;
+    };
+
+    /**
+     * @brief Compiles a TZif file (RFC 8536) in memory to a TimeZone.
+     *
+     * Transitions after the last one in the file are generated from
+     * the file's POSIX TZ string up to and including year 2200.
+     *
+     * @throw YtimeException if the data are not a valid TZif file.
+     */
+    TimeZone parseTzif(const char* data, size_t size, std::string name);
+
+    /**
+     * @brief Reads the named time zone, e.g. "Europe/Oslo", from the
+     *      directory in the environment variable TZDIR or
+     *      /usr/share/zoneinfo.
+     *
+     * @throw YtimeException if the file can't be read or is invalid.
+     */
+    TimeZone loadTimeZone(const std::string& name);
+}
@@ -0,0 +1,59 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <vector>
+#include "PackedDateTime.hpp"
+
+namespace Ytime
+{
+    struct TimestampGap
+    {
+        /** @brief The index of the first value after the gap. */
+        size_t index;
+        /** @brief The last value before the gap. */
+        PackedDateTime start;
+        DateTimeDelta length;
+    };
+
+    /**
+     * @brief The result of analyzeTimestamps.
+     *
+     * All intervals are elapsed time in microseconds, leap seconds
+     * included.
+     */
+    struct TimestampAnalysis
+    {
+        std::vector<TimestampGap> gaps;
+        /** @brief Indices of values that are equal to the previous value. */
+        std::vector<size_t> duplicates;
+        /** @brief Indices of values that are less than the previous value. */
+        std::vector<size_t> inversions;
+        /** @brief The number of positive intervals. */
+        size_t intervalCount = 0;
+        /** @brief Statistics for the positive intervals. */
+        DateTimeDelta minInterval;
+        DateTimeDelta maxInterval;
+        DateTimeDelta medianInterval;
+    };
+
+    /**
+     * @brief Finds gaps, duplicates and inversions in a series of
+     *      timestamps.
+     *
+     * Intervals longer than @a maxInterval are reported as gaps. The
+     * intervals are computed and checked in blocks with loops the
+     * compiler can vectorize, only blocks with irregularities are
+     * inspected value by value. Leap seconds need no special handling
+     * since the intervals are elapsed time.
+     *
+     * @throw YtimeException if @a maxInterval isn't positive.
+     */
+    TimestampAnalysis analyzeTimestamps(const PackedDateTime* values,
+                                        size_t count,
+                                        DateTimeDelta maxInterval);
+}
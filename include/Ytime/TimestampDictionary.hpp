@@ -0,0 +1,140 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "PackedDateTime.hpp"
+
+/** @file Dictionary encoding of columns with repeated timestamps.
+
+    The dictionary holds the unique timestamps in ascending order, and
+    each row is stored as the index of its timestamp in the dictionary.
+    Because the dictionary is sorted, the codes compare the same way as
+    the timestamps they stand for, and a time range corresponds to a
+    range of codes:
+
+    @code
+    TimestampDictionary dictionary(values.data(), values.size());
+    std::vector<uint16_t> codes(values.size());
+    dictionary.encode(values.data(), values.size(), codes.data());
+    dictionary.matchRange(codes.data(), codes.size(), from, to,
+                          selected.data());
+    @endcode
+*/
+
+namespace Ytime
+{
+    class TimestampDictionary
+    {
+    public:
+        TimestampDictionary() noexcept;
+
+        /**
+         * @brief Creates a dictionary of the unique values among the
+         *      first @a count values in @a values.
+         */
+        TimestampDictionary(const PackedDateTime* values, size_t count);
+
+        /**
+         * @brief Returns the unique values in ascending order.
+         */
+        const std::vector<PackedDateTime>& values() const noexcept;
+
+        size_t size() const noexcept;
+
+        /**
+         * @brief Returns the size in bytes of the smallest code type
+         *      that can hold every code, i.e. 1, 2 or 4.
+         */
+        size_t codeSize() const noexcept;
+
+        /**
+         * @brief Returns the code of @a value, or -1 if @a value isn't
+         *      in the dictionary.
+         */
+        int64_t find(PackedDateTime value) const noexcept;
+
+        /**
+         * @brief Writes the code of each of the first @a count values in
+         *      @a values to @a codes.
+         *
+         * @throw YtimeException if a value isn't in the dictionary, or
+         *      the dictionary has more values than the code type can
+         *      represent.
+         */
+        void encode(const PackedDateTime* values, size_t count,
+                    uint8_t* codes) const;
+
+        void encode(const PackedDateTime* values, size_t count,
+                    uint16_t* codes) const;
+
+        void encode(const PackedDateTime* values, size_t count,
+                    uint32_t* codes) const;
+
+        /**
+         * @brief Writes the value of each of the first @a count codes in
+         *      @a codes to @a result.
+         *
+         * The codes are not checked, they must be less than size().
+         */
+        void decode(const uint8_t* codes, size_t count,
+                    PackedDateTime* result) const noexcept;
+
+        void decode(const uint16_t* codes, size_t count,
+                    PackedDateTime* result) const noexcept;
+
+        void decode(const uint32_t* codes, size_t count,
+                    PackedDateTime* result) const noexcept;
+
+        /**
+         * @brief Returns the range of codes [first, last) whose values
+         *      are in the range [@a from, @a to).
+         */
+        std::pair<uint32_t, uint32_t>
+        findRange(PackedDateTime from, PackedDateTime to) const noexcept;
+
+        /**
+         * @brief Sets each of the first @a count values in @a result to
+         *      true if the value of the corresponding code in @a codes
+         *      is in the range [@a from, @a to).
+         *
+         * The range is looked up in the dictionary once, the codes are
+         * then compared directly.
+         */
+        void matchRange(const uint8_t* codes, size_t count,
+                        PackedDateTime from, PackedDateTime to,
+                        bool* result) const noexcept;
+
+        void matchRange(const uint16_t* codes, size_t count,
+                        PackedDateTime from, PackedDateTime to,
+                        bool* result) const noexcept;
+
+        void matchRange(const uint32_t* codes, size_t count,
+                        PackedDateTime from, PackedDateTime to,
+                        bool* result) const noexcept;
+    private:
+        struct Slot
+        {
+            uint64_t value;
+            uint32_t code;
+        };
+
+        template <typename Code>
+        void encodeImpl(const PackedDateTime* values, size_t count,
+                        Code* codes) const;
+
+        Slot* findSlot(uint64_t value) noexcept;
+
+        const Slot* findSlot(uint64_t value) const noexcept;
+
+        std::vector<PackedDateTime> m_Values;
+        /* An open addressing hash table from value to code. */
+        std::vector<Slot> m_Slots;
+    };
+}
@@ -0,0 +1,65 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <optional>
+#include <string_view>
+#include "DateTimeFormat.hpp"
+
+namespace Ytime
+{
+    /**
+     * @brief A parser for a column of timestamps that is specialized for
+     *      the format detected by detectTimestampParser.
+     *
+     * Values that don't match the detected format are tried against the
+     * other known formats with the same length before falling back to
+     * Ytime::parseDateTime.
+     */
+    class TimestampParser
+    {
+    public:
+        TimestampParser() noexcept = default;
+
+        explicit TimestampParser(const DateTimeFormat& format) noexcept
+            : m_Format(format)
+        {}
+
+        /**
+         * @brief Returns the detected format, or an empty optional if no
+         *      known format matched the samples.
+         */
+        const std::optional<DateTimeFormat>& format() const noexcept
+        {
+            return m_Format;
+        }
+
+        /**
+         * @brief Parses and validates @a str.
+         *
+         * Time-only values have a zero date, as with Ytime::parseDateTime.
+         */
+        std::optional<DateTime> parseDateTime(std::string_view str) const;
+
+        std::optional<PackedDateTime> parse(std::string_view str) const;
+    private:
+        std::optional<DateTime> parseFallback(std::string_view str) const;
+
+        std::optional<DateTimeFormat> m_Format;
+    };
+
+    /**
+     * @brief Returns a parser for the format that matches most of
+     *      the first @a count values in @a samples.
+     *
+     * The known formats are ISO 8601 dates, times and date-times with
+     * 'T' or space as separator, zero to six fractional digits, and the
+     * compact forms YYYYMMDD, YYYYMMDDTHHmmSS and YYYYMMDDHHmmSS.
+     */
+    TimestampParser
+    detectTimestampParser(const std::string_view* samples, size_t count);
+}
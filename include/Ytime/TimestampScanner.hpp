@@ -0,0 +1,77 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <optional>
+#include <string_view>
+#include <vector>
+#include "PackedDateTime.hpp"
+
+/** @file Functions that find ISO 8601 timestamps embedded in text, e.g.
+    log lines where the timestamp follows a level tag or is enclosed in
+    brackets.
+
+    A timestamp is a date, YYYY-MM-DD, optionally followed by 'T' or a
+    space and HH:mm:SS, a fraction of up to nine digits (only the first
+    six are used) and "Z", "+hh:mm", "-hh:mm", "+hhmm" or "-hhmm".
+    Timestamps with a UTC offset are converted to UTC. The date must not
+    be preceded or followed by another digit, and the date and time must
+    pass validate().
+
+    Candidates are located with SSE2 or AVX2 when available by searching
+    for pairs of dashes three bytes apart.
+*/
+
+namespace Ytime
+{
+    struct TimestampMatch
+    {
+        /** @brief The offset of the timestamp in the scanned text. */
+        size_t offset = 0;
+        /** @brief The length of the timestamp, 0 if there is none. */
+        size_t length = 0;
+        PackedDateTime dateTime = {};
+    };
+
+    constexpr bool operator==(const TimestampMatch& a,
+                              const TimestampMatch& b) noexcept
+    {
+        return a.offset == b.offset && a.length == b.length
+               && a.dateTime == b.dateTime;
+    }
+
+    constexpr bool operator!=(const TimestampMatch& a,
+                              const TimestampMatch& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    /**
+     * @brief Returns the first timestamp in @a str that starts at or
+     *      after @a pos.
+     */
+    std::optional<TimestampMatch>
+    findTimestamp(std::string_view str, size_t pos = 0) noexcept;
+
+    /**
+     * @brief Appends every timestamp in @a buffer to @a result.
+     */
+    void findTimestamps(std::string_view buffer,
+                        std::vector<TimestampMatch>& result);
+
+    /**
+     * @brief Appends one match per line in @a buffer to @a result, the
+     *      first timestamp on the line.
+     *
+     * Lines are separated by '\\n'. A line without a timestamp gets a
+     * match with the line's offset and zero length, so result[i] always
+     * belongs to line i. A final line without a trailing '\\n' is
+     * included if it isn't empty.
+     */
+    void findLineTimestamps(std::string_view buffer,
+                            std::vector<TimestampMatch>& result);
+}
@@ -0,0 +1,109 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include "TimestampParser.hpp"
+
+/** @file Incremental parsing of timestamps that arrive in chunks.
+
+    A TimestampStream is given the bytes of a line-oriented input as they
+    arrive from a socket, a pipe or an asynchronous file read, and hands
+    back the parsed timestamps in batches. It never reads or waits for
+    anything itself, so it can be driven from any event loop, executor
+    or thread:
+
+    @code
+    void onData(std::string_view chunk) // Called by the I/O layer.
+    {
+        stream.write(chunk);
+        while (!stream.needsInput())
+            consume(stream.read());
+        // The chunk's buffer can be reused, request the next read.
+    }
+    @endcode
+
+    Parsing is done by read, one batch at a time, and the stream accepts
+    no more input until the previous chunk has been consumed. A consumer
+    that falls behind therefore holds back the producer instead of
+    letting parsed values pile up.
+*/
+
+namespace Ytime
+{
+    class TimestampStream
+    {
+    public:
+        /**
+         * @param parser Parses each line.
+         * @param maxBatchSize The maximum number of values returned by
+         *      each call to read.
+         * @param invalidValue The value returned for lines that can't be
+         *      parsed.
+         * @throw YtimeException if @a maxBatchSize is 0.
+         */
+        TimestampStream(const TimestampParser& parser, size_t maxBatchSize,
+                        PackedDateTime invalidValue = PackedDateTime());
+
+        /**
+         * @brief Returns true when read has consumed the previous chunk
+         *      and the next one can be written.
+         */
+        bool needsInput() const noexcept;
+
+        /**
+         * @brief Returns true when the stream has been closed and every
+         *      value has been read.
+         */
+        bool atEnd() const noexcept;
+
+        /**
+         * @brief Gives the stream the next chunk of input.
+         *
+         * The stream refers to @a chunk without copying it, except for
+         * the start of a line that continues in the next chunk. The
+         * chunk must therefore stay valid until needsInput returns true.
+         *
+         * @throw YtimeException if the previous chunk hasn't been
+         *      consumed or the stream has been closed.
+         */
+        void write(std::string_view chunk);
+
+        /**
+         * @brief Marks the end of the input. A final line without a
+         *      trailing newline is returned by the next read.
+         */
+        void close();
+
+        /**
+         * @brief Parses and returns the next batch of values, one for
+         *      each line.
+         *
+         * Lines are separated by '\\n', and a trailing '\\r' is removed
+         * from each line. The batch has at most maxBatchSize values, and
+         * is empty if the stream needs input or is at the end. It is
+         * valid until the next call to read.
+         */
+        const std::vector<PackedDateTime>& read();
+
+        size_t maxBatchSize() const noexcept;
+    private:
+        bool parseNext(PackedDateTime& value);
+
+        PackedDateTime parseLine(std::string_view line) const;
+
+        TimestampParser m_Parser;
+        size_t m_MaxBatchSize;
+        PackedDateTime m_InvalidValue;
+        std::string_view m_Chunk;
+        std::string m_Partial;
+        std::vector<PackedDateTime> m_Batch;
+        bool m_Closed = false;
+    };
+}
@@ -0,0 +1,87 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstddef>
+#include <ctime>
+#include "PackedDateTime.hpp"
+
+/** @file Conversions between PackedDateTime and POSIX and NTP time.
+
+    Neither POSIX nor NTP time count leap seconds, a day is always 86400
+    seconds. A leap second, 23:59:60.xxx, is converted to the same POSIX
+    or NTP time as 00:00:00.xxx the following day. This is how POSIX
+    clocks step back over a leap second, and it makes the conversion to
+    POSIX or NTP time non-decreasing. The conversions from POSIX or NTP
+    time never return a leap second.
+
+    The batch functions convert @a count values from @a values to
+    @a result. They are fastest on sorted input, where all the values
+    in a block are converted with the same leap second offset.
+*/
+
+namespace Ytime
+{
+    PackedDateTime fromUnixTime(int64_t secs) noexcept;
+
+    PackedDateTime fromUnixTimeUsecs(int64_t usecs) noexcept;
+
+    PackedDateTime fromUnixTimeNsecs(int64_t nsecs) noexcept;
+
+    PackedDateTime fromTimespec(const timespec& ts) noexcept;
+
+    int64_t toUnixTime(PackedDateTime dateTime) noexcept;
+
+    int64_t toUnixTimeUsecs(PackedDateTime dateTime) noexcept;
+
+    int64_t toUnixTimeNsecs(PackedDateTime dateTime) noexcept;
+
+    timespec toTimespec(PackedDateTime dateTime) noexcept;
+
+    void fromUnixTime(const int64_t* values, size_t count,
+                      PackedDateTime* result) noexcept;
+
+    void fromUnixTimeUsecs(const int64_t* values, size_t count,
+                           PackedDateTime* result) noexcept;
+
+    void fromUnixTimeNsecs(const int64_t* values, size_t count,
+                           PackedDateTime* result) noexcept;
+
+    void toUnixTime(const PackedDateTime* values, size_t count,
+                    int64_t* result) noexcept;
+
+    void toUnixTimeUsecs(const PackedDateTime* values, size_t count,
+                         int64_t* result) noexcept;
+
+    void toUnixTimeNsecs(const PackedDateTime* values, size_t count,
+                         int64_t* result) noexcept;
+
+    /**
+     * @brief Returns the PackedDateTime for a 64-bit NTP timestamp.
+     *
+     * The upper 32 bits of @a timestamp are seconds since the start of
+     * NTP era @a era, the lower 32 bits are the fraction of a second.
+     * Era 0 started 1900-01-01, era 1 starts 2036-02-07.
+     */
+    PackedDateTime fromNtpTimestamp(uint64_t timestamp, int era = 0) noexcept;
+
+    /**
+     * @brief Returns the 64-bit NTP timestamp for @a dateTime.
+     *
+     * The fraction is rounded up so that converting the timestamp back
+     * returns @a dateTime. Use getNtpEra to get the era.
+     */
+    uint64_t toNtpTimestamp(PackedDateTime dateTime) noexcept;
+
+    int getNtpEra(PackedDateTime dateTime) noexcept;
+
+    void fromNtpTimestamp(const uint64_t* values, size_t count,
+                          PackedDateTime* result, int era = 0) noexcept;
+
+    void toNtpTimestamp(const PackedDateTime* values, size_t count,
+                        uint64_t* result) noexcept;
+}
@@ -0,0 +1,19 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+/* With YTIME_HEADER_ONLY the core conversion functions (pack, unpack,
+   getLeapSeconds etc.) are defined inline in the headers, so the
+   compiler can inline them into loops in the calling code. The CMake
+   option YTIME_HEADER_ONLY defines it for both the library and its
+   users, it must never be defined for only one of them. */
+#ifdef YTIME_HEADER_ONLY
+    #define YTIME_INLINE inline
+#else
+    #define YTIME_INLINE
+#endif
@@ -0,0 +1,264 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/ArrowInterface.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include "Ytime/UnixTime.hpp"
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr size_t BLOCK_SIZE = 256;
+
+        /* The private data of an exported array. */
+        template <typename T>
+        struct ExportedArray
+        {
+            std::vector<T> values;
+            const void* buffers[2] = {};
+        };
+
+        template <typename T>
+        void releaseArray(ArrowArray* array)
+        {
+            delete static_cast<ExportedArray<T>*>(array->private_data);
+            array->release = nullptr;
+        }
+
+        void releaseSchema(ArrowSchema* schema)
+        {
+            schema->release = nullptr;
+        }
+
+        void initSchema(ArrowSchema* schema, const char* format)
+        {
+            *schema = {};
+            schema->format = format;
+            schema->flags = ARROW_FLAG_NULLABLE;
+            schema->release = releaseSchema;
+        }
+
+        template <typename T>
+        void initArray(ArrowArray* array, ExportedArray<T>* data)
+        {
+            *array = {};
+            data->buffers[1] = data->values.data();
+            array->length = int64_t(data->values.size());
+            array->n_buffers = 2;
+            array->buffers = data->buffers;
+            array->release = releaseArray<T>;
+            array->private_data = data;
+        }
+
+        bool isNull(const ArrowArray* array, int64_t i) noexcept
+        {
+            if (array->null_count == 0 || !array->buffers[0])
+                return false;
+            auto bits = static_cast<const uint8_t*>(array->buffers[0]);
+            auto j = array->offset + i;
+            return ((bits[j / 8] >> (j % 8)) & 1u) == 0;
+        }
+
+        /* The range of Unix times in microseconds that are imported.
+           The lower limit is PackedDateTime 0, the upper limit is far
+           beyond any date, but far enough from INT64_MAX that adding
+           the epoch and the leap seconds can't overflow. */
+        constexpr int64_t MIN_UNIX_USECS =
+            -int64_t(Detail::UNIX_EPOCH_DAYS) * int64_t(USECS_PER_DAY);
+        constexpr int64_t MAX_UNIX_USECS =
+            std::numeric_limits<int64_t>::max() / 2;
+
+        /* Converts value, in units of 1 / UNITS_PER_SEC seconds, to
+           microseconds clamped to the range above. Arrow allows any
+           value in null slots, this keeps the conversion of those
+           well-defined as well. */
+        template <int64_t UNITS_PER_SEC>
+        int64_t toClampedUsecs(int64_t value) noexcept
+        {
+            constexpr auto USECS = int64_t(USECS_PER_SEC);
+            if constexpr (UNITS_PER_SEC <= USECS)
+            {
+                constexpr auto factor = USECS / UNITS_PER_SEC;
+                return std::clamp(value, MIN_UNIX_USECS / factor,
+                                  MAX_UNIX_USECS / factor) * factor;
+            }
+            else
+            {
+                constexpr auto divisor = UNITS_PER_SEC / USECS;
+                return std::clamp(Detail::floorDiv(value, divisor),
+                                  MIN_UNIX_USECS, MAX_UNIX_USECS);
+            }
+        }
+
+        template <int64_t UNITS_PER_SEC>
+        void importUnixTimes(const int64_t* values, size_t count,
+                             PackedDateTime* result)
+        {
+            int64_t tmp[BLOCK_SIZE];
+            for (size_t i = 0; i < count; i += BLOCK_SIZE)
+            {
+                auto n = std::min(BLOCK_SIZE, count - i);
+                for (size_t j = 0; j < n; ++j)
+                    tmp[j] = toClampedUsecs<UNITS_PER_SEC>(values[i + j]);
+                fromUnixTimeUsecs(tmp, n, result + i);
+            }
+        }
+
+        /* Returns the values buffer of a primitive array. */
+        template <typename T>
+        const T* getValues(const ArrowArray* array)
+        {
+            if (!array || !array->release || array->n_buffers != 2
+                || array->length < 0 || array->offset < 0
+                || (array->length != 0 && !array->buffers[1]))
+            {
+                YTIME_THROW("Unsupported Arrow array layout.");
+            }
+            return static_cast<const T*>(array->buffers[1]) + array->offset;
+        }
+
+        /* Days before the epoch, 1200-03-01, can only be garbage in null
+           values, they are clamped to keep toYMD well-defined. */
+        Date toDate(int64_t unixDays) noexcept
+        {
+            auto days = std::max<int64_t>(unixDays + Detail::UNIX_EPOCH_DAYS,
+                                          0);
+            return Detail::toYMD(uint64_t(days));
+        }
+
+        template <typename T>
+        void setNullValues(const ArrowArray* array, T* result, T nullValue)
+        {
+            if (array->null_count == 0 || !array->buffers[0])
+                return;
+            for (int64_t i = 0; i < array->length; ++i)
+            {
+                if (isNull(array, i))
+                    result[i] = nullValue;
+            }
+        }
+    }
+
+    void exportTimestamps(const PackedDateTime* values, size_t count,
+                          ArrowArray* array, ArrowSchema* schema)
+    {
+        auto data = std::make_unique<ExportedArray<int64_t>>();
+        data->values.resize(count);
+        toUnixTimeUsecs(values, count, data->values.data());
+        initArray(array, data.release());
+        initSchema(schema, "tsu:UTC");
+    }
+
+    void exportTimestamps(std::vector<PackedDateTime>&& values,
+                          ArrowArray* array, ArrowSchema* schema)
+    {
+        /* The values are converted a block at a time through a temporary
+           buffer, the buffer can then be handed over to Arrow as an
+           int64_t buffer. */
+        int64_t tmp[BLOCK_SIZE];
+        for (size_t i = 0; i < values.size(); i += BLOCK_SIZE)
+        {
+            auto n = std::min(BLOCK_SIZE, values.size() - i);
+            toUnixTimeUsecs(values.data() + i, n, tmp);
+            std::memcpy(values.data() + i, tmp, n * sizeof(int64_t));
+        }
+
+        auto data = std::make_unique<ExportedArray<PackedDateTime>>();
+        data->values = std::move(values);
+        initArray(array, data.release());
+        initSchema(schema, "tsu:UTC");
+    }
+
+    void exportDates(const Date* values, size_t count,
+                     ArrowArray* array, ArrowSchema* schema)
+    {
+        auto data = std::make_unique<ExportedArray<int32_t>>();
+        data->values.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto days = int64_t(Detail::daysSinceEpochYMD(values[i]));
+            data->values[i] = int32_t(days
+                                      - int64_t(Detail::UNIX_EPOCH_DAYS));
+        }
+        initArray(array, data.release());
+        initSchema(schema, "tdD");
+    }
+
+    void importTimestamps(const ArrowArray* array, const ArrowSchema* schema,
+                          PackedDateTime* result, PackedDateTime nullValue)
+    {
+        if (!schema || !schema->format)
+            YTIME_THROW("Arrow schema has no format.");
+        std::string_view format = schema->format;
+        if (format.size() < 4 || format.substr(0, 2) != "ts"
+            || format[3] != ':')
+        {
+            YTIME_THROW("Arrow format is not a timestamp: "
+                        + std::string(format));
+        }
+
+        auto values = getValues<int64_t>(array);
+        auto count = size_t(array->length);
+        switch (format[2])
+        {
+        case 's':
+            importUnixTimes<1>(values, count, result);
+            break;
+        case 'm':
+            importUnixTimes<1000>(values, count, result);
+            break;
+        case 'u':
+            importUnixTimes<1000000>(values, count, result);
+            break;
+        case 'n':
+            importUnixTimes<1000000000>(values, count, result);
+            break;
+        default:
+            YTIME_THROW("Unknown Arrow timestamp unit: " + std::string(format));
+        }
+
+        setNullValues(array, result, nullValue);
+    }
+
+    void importDates(const ArrowArray* array, const ArrowSchema* schema,
+                     Date* result, Date nullValue)
+    {
+        if (!schema || !schema->format)
+            YTIME_THROW("Arrow schema has no format.");
+        std::string_view format = schema->format;
+        auto count = size_t(array ? array->length : 0);
+        if (format == "tdD")
+        {
+            auto values = getValues<int32_t>(array);
+            for (size_t i = 0; i < count; ++i)
+                result[i] = toDate(values[i]);
+        }
+        else if (format == "tdm")
+        {
+            auto values = getValues<int64_t>(array);
+            for (size_t i = 0; i < count; ++i)
+            {
+                result[i] = toDate(Detail::floorDiv(values[i],
+                                                    SECS_PER_DAY * 1000));
+            }
+        }
+        else
+        {
+            YTIME_THROW("Arrow format is not a date: " + std::string(format));
+        }
+
+        setNullValues(array, result, nullValue);
+    }
+}
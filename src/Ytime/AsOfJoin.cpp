@@ -0,0 +1,154 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/AsOfJoin.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr size_t MIN_PARTITION_SIZE = 1 << 16;
+
+        /* Returns the first index at or after j where right[k] is not
+           before value. Whole blocks are skipped by looking at their last
+           element, and the position inside the final block is found by
+           counting, which the compiler can vectorize. */
+        template <bool Inclusive>
+        size_t skipBefore(const PackedDateTime* right, size_t j, size_t n,
+                          PackedDateTime value) noexcept
+        {
+            constexpr size_t BLOCK_SIZE = 16;
+            auto isBefore = [value](PackedDateTime t)
+            {
+                return Inclusive ? t <= value : t < value;
+            };
+
+            while (n - j >= BLOCK_SIZE && isBefore(right[j + BLOCK_SIZE - 1]))
+                j += BLOCK_SIZE;
+
+            auto m = std::min(BLOCK_SIZE, n - j);
+            size_t count = 0;
+            for (size_t k = 0; k < m; ++k)
+                count += isBefore(right[j + k]) ? 1 : 0;
+            return j + count;
+        }
+
+        int64_t getDistance(PackedDateTime a, PackedDateTime b) noexcept
+        {
+            return a < b ? int64_t(b - a) : int64_t(a - b);
+        }
+
+        int64_t getToleranceUsecs(const std::optional<DateTimeDelta>& tolerance)
+        {
+            if (!tolerance)
+                return std::numeric_limits<int64_t>::max();
+            auto usecs = tolerance->days() * int64_t(USECS_PER_DAY)
+                         + tolerance->totalUseconds();
+            if (usecs < 0)
+                YTIME_THROW("The as-of tolerance can not be negative.");
+            return usecs;
+        }
+
+        void joinPartition(const PackedDateTime* left, size_t leftCount,
+                           const PackedDateTime* right, size_t rightCount,
+                           size_t* result, AsOfDirection direction,
+                           int64_t tolerance) noexcept
+        {
+            if (leftCount == 0)
+                return;
+
+            /* j is the number of right values before the current left
+               value, either inclusive or exclusive. */
+            auto inclusive = direction != AsOfDirection::FORWARD;
+            auto j = inclusive
+                     ? size_t(std::upper_bound(right, right + rightCount, left[0]) - right)
+                     : size_t(std::lower_bound(right, right + rightCount, left[0]) - right);
+
+            for (size_t i = 0; i < leftCount; ++i)
+            {
+                auto value = left[i];
+                auto match = ASOF_NO_MATCH;
+                if (inclusive)
+                {
+                    j = skipBefore<true>(right, j, rightCount, value);
+                    if (j != 0)
+                        match = j - 1;
+                    if (direction == AsOfDirection::NEAREST && j != rightCount
+                        && (match == ASOF_NO_MATCH
+                            || getDistance(right[j], value)
+                               < getDistance(right[match], value)))
+                    {
+                        match = j;
+                    }
+                }
+                else
+                {
+                    j = skipBefore<false>(right, j, rightCount, value);
+                    if (j != rightCount)
+                        match = j;
+                }
+
+                if (match != ASOF_NO_MATCH
+                    && getDistance(right[match], value) > tolerance)
+                {
+                    match = ASOF_NO_MATCH;
+                }
+                result[i] = match;
+            }
+        }
+    }
+
+    void asOfJoin(const PackedDateTime* left, size_t leftCount,
+                  const PackedDateTime* right, size_t rightCount,
+                  size_t* result, AsOfDirection direction,
+                  std::optional<DateTimeDelta> tolerance)
+    {
+        joinPartition(left, leftCount, right, rightCount, result, direction,
+                      getToleranceUsecs(tolerance));
+    }
+
+    void asOfJoinParallel(const PackedDateTime* left, size_t leftCount,
+                          const PackedDateTime* right, size_t rightCount,
+                          size_t* result, AsOfDirection direction,
+                          std::optional<DateTimeDelta> tolerance,
+                          unsigned threadCount)
+    {
+        auto toleranceUsecs = getToleranceUsecs(tolerance);
+        if (threadCount == 0)
+            threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        auto partitions = std::min(size_t(threadCount),
+                                   leftCount / MIN_PARTITION_SIZE);
+        if (partitions <= 1)
+        {
+            joinPartition(left, leftCount, right, rightCount, result,
+                          direction, toleranceUsecs);
+            return;
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(partitions - 1);
+        auto size = (leftCount + partitions - 1) / partitions;
+        for (size_t p = 1; p < partitions; ++p)
+        {
+            auto first = p * size;
+            auto count = std::min(size, leftCount - first);
+            threads.emplace_back(joinPartition, left + first, count,
+                                 right, rightCount, result + first,
+                                 direction, toleranceUsecs);
+        }
+        joinPartition(left, size, right, rightCount, result, direction,
+                      toleranceUsecs);
+        for (auto& thread : threads)
+            thread.join();
+    }
+}
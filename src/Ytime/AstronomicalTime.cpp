@@ -0,0 +1,233 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/AstronomicalTime.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include "Ytime/LeapSeconds.hpp"
+#include "Ytime/Detail/LeapSecondTable.hpp"
+#include "InternalInstrumentation.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr int64_t DAY = USECS_PER_DAY;
+        constexpr int64_t SECOND = USECS_PER_SEC;
+        constexpr int64_t TAI_UTC_1972 = 10 * SECOND;
+        constexpr int64_t TT_TAI = 32184000;
+
+        /* The Modified Julian Date of day 0, 1200-03-01. MJD 0 is
+           1858-11-17. */
+        constexpr int64_t MJD_EPOCH =
+            -int64_t(Detail::daysSinceEpochYMD({1858, 11, 17}));
+        /* JD = MJD + 2400000.5 */
+        constexpr int64_t JD_MJD_DAYS = 2400000;
+
+        int64_t getScaleOffset(TimeScale scale) noexcept
+        {
+            return scale == TimeScale::TT ? TAI_UTC_1972 + TT_TAI : TAI_UTC_1972;
+        }
+
+        int64_t getDayLength(uint32_t day) noexcept
+        {
+            if (Detail::getLeapSecondsForDay(day + 1)
+                != Detail::getLeapSecondsForDay(day))
+                return DAY + SECOND;
+            return DAY;
+        }
+
+        DayFraction makeDayFraction(int64_t day, int64_t usecs,
+                                    int64_t dayLength) noexcept
+        {
+            return {day, double(usecs) / double(dayLength)};
+        }
+
+        /* Returns the day number and fraction relative to day 0. */
+        DayFraction toEpochDay(PackedDateTime dateTime, TimeScale scale) noexcept
+        {
+            if (scale != TimeScale::UTC)
+            {
+                auto t = int64_t(dateTime) + getScaleOffset(scale);
+                auto day = Detail::floorDiv(t, DAY);
+                return makeDayFraction(day, t - day * DAY, DAY);
+            }
+
+            auto [day, usecs] = Detail::unpackDaysUsecondsUtc(dateTime);
+            return makeDayFraction(int64_t(day), int64_t(usecs),
+                                   getDayLength(day));
+        }
+
+        PackedDateTime fromEpochDay(DayFraction value, TimeScale scale) noexcept
+        {
+            auto whole = std::floor(value.fraction);
+            value.day += int64_t(whole);
+            value.fraction -= whole;
+
+            if (scale != TimeScale::UTC)
+            {
+                auto usecs = std::llround(value.fraction * DAY);
+                return PackedDateTime(value.day * DAY + usecs
+                                      - getScaleOffset(scale));
+            }
+
+            auto day = uint32_t(value.day);
+            auto usecs = std::llround(value.fraction * double(getDayLength(day)));
+            return PackedDateTime(Detail::packDaysUseconds(day, uint64_t(usecs))
+                                  + Detail::getLeapSecondsForDay(day)
+                                    * USECS_PER_SEC);
+        }
+
+        DayFraction epochDayToJulianDay(const DayFraction& value) noexcept
+        {
+            /* Julian days start at noon. */
+            auto day = value.day + MJD_EPOCH + JD_MJD_DAYS;
+            if (value.fraction >= 0.5)
+                return {day + 1, value.fraction - 0.5};
+            return {day, value.fraction + 0.5};
+        }
+
+        /* Converts the values in blocks. For UTC the block is converted
+           with a single leap second offset if it doesn't touch a day with
+           a leap second. */
+        template <typename Out, typename Convert>
+        void convertBatch(const PackedDateTime* values, size_t count,
+                          Out* result, TimeScale scale, Convert convert)
+        {
+            YTIME_TIME_BATCH(count);
+            constexpr size_t BLOCK_SIZE = 256;
+            auto& table = Detail::getLeapSecondData();
+            for (size_t i = 0; i < count; i += BLOCK_SIZE)
+            {
+                auto n = std::min(BLOCK_SIZE, count - i);
+                auto in = values + i;
+                auto out = result + i;
+
+                int64_t offset;
+                if (scale != TimeScale::UTC)
+                {
+                    offset = getScaleOffset(scale);
+                }
+                else
+                {
+                    auto min = int64_t(*std::min_element(in, in + n));
+                    auto max = int64_t(*std::max_element(in, in + n));
+                    auto end = table.packedBounds + table.size;
+                    auto it = std::upper_bound(table.packedBounds, end, min);
+                    /* The start of the day with the next leap second. */
+                    auto limit = it == end ? INT64_MAX : *it - SECOND - DAY;
+                    if (max >= limit)
+                    {
+                        YTIME_COUNT(slowPaths);
+                        for (size_t j = 0; j < n; ++j)
+                            out[j] = convert(toEpochDay(in[j], scale));
+                        continue;
+                    }
+                    offset = -int64_t(it - table.packedBounds) * SECOND;
+                }
+
+                for (size_t j = 0; j < n; ++j)
+                {
+                    auto t = int64_t(in[j]) + offset;
+                    auto day = Detail::floorDiv(t, DAY);
+                    out[j] = convert(makeDayFraction(day, t - day * DAY, DAY));
+                }
+            }
+        }
+    }
+
+    DayFraction toJulianDay(PackedDateTime dateTime, TimeScale scale) noexcept
+    {
+        return epochDayToJulianDay(toEpochDay(dateTime, scale));
+    }
+
+    DayFraction toModifiedJulianDay(PackedDateTime dateTime,
+                                    TimeScale scale) noexcept
+    {
+        auto value = toEpochDay(dateTime, scale);
+        return {value.day + MJD_EPOCH, value.fraction};
+    }
+
+    PackedDateTime fromJulianDay(const DayFraction& jd, TimeScale scale) noexcept
+    {
+        return fromEpochDay({jd.day - JD_MJD_DAYS - MJD_EPOCH, jd.fraction - 0.5},
+                            scale);
+    }
+
+    PackedDateTime fromModifiedJulianDay(const DayFraction& mjd,
+                                         TimeScale scale) noexcept
+    {
+        return fromEpochDay({mjd.day - MJD_EPOCH, mjd.fraction}, scale);
+    }
+
+    double toJulianDate(PackedDateTime dateTime, TimeScale scale) noexcept
+    {
+        auto jd = toJulianDay(dateTime, scale);
+        return double(jd.day) + jd.fraction;
+    }
+
+    double toModifiedJulianDate(PackedDateTime dateTime,
+                                TimeScale scale) noexcept
+    {
+        auto mjd = toModifiedJulianDay(dateTime, scale);
+        return double(mjd.day) + mjd.fraction;
+    }
+
+    PackedDateTime fromJulianDate(double jd, TimeScale scale) noexcept
+    {
+        auto day = std::floor(jd);
+        return fromJulianDay({int64_t(day), jd - day}, scale);
+    }
+
+    PackedDateTime fromModifiedJulianDate(double mjd, TimeScale scale) noexcept
+    {
+        auto day = std::floor(mjd);
+        return fromModifiedJulianDay({int64_t(day), mjd - day}, scale);
+    }
+
+    int64_t getTaiOffsetUsecs(PackedDateTime dateTime) noexcept
+    {
+        return TAI_UTC_1972 + int64_t(getLeapSeconds(dateTime)) * SECOND;
+    }
+
+    void toModifiedJulianDay(const PackedDateTime* values, size_t count,
+                             DayFraction* result, TimeScale scale) noexcept
+    {
+        convertBatch(values, count, result, scale, [](const DayFraction& d)
+        {
+            return DayFraction{d.day + MJD_EPOCH, d.fraction};
+        });
+    }
+
+    void toModifiedJulianDate(const PackedDateTime* values, size_t count,
+                              double* result, TimeScale scale) noexcept
+    {
+        convertBatch(values, count, result, scale, [](const DayFraction& d)
+        {
+            return double(d.day + MJD_EPOCH) + d.fraction;
+        });
+    }
+
+    void toJulianDate(const PackedDateTime* values, size_t count,
+                      double* result, TimeScale scale) noexcept
+    {
+        convertBatch(values, count, result, scale, [](const DayFraction& d)
+        {
+            auto jd = epochDayToJulianDay(d);
+            return double(jd.day) + jd.fraction;
+        });
+    }
+
+    void fromModifiedJulianDate(const double* values, size_t count,
+                                PackedDateTime* result, TimeScale scale) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+            result[i] = fromModifiedJulianDate(values[i], scale);
+    }
+}
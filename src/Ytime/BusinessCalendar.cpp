@@ -0,0 +1,169 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/BusinessCalendar.hpp"
+
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        int popcount(uint64_t bits) noexcept
+        {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(bits);
+        #else
+            bits = bits - ((bits >> 1u) & 0x5555555555555555u);
+            bits = (bits & 0x3333333333333333u)
+                   + ((bits >> 2u) & 0x3333333333333333u);
+            bits = (bits + (bits >> 4u)) & 0x0F0F0F0F0F0F0F0Fu;
+            return int((bits * 0x0101010101010101u) >> 56u);
+        #endif
+        }
+
+        int countTrailingZeros(uint64_t bits) noexcept
+        {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(bits);
+        #else
+            int n = 0;
+            while ((bits & 1u) == 0)
+            {
+                bits >>= 1u;
+                ++n;
+            }
+            return n;
+        #endif
+        }
+    }
+
+    BusinessCalendar::BusinessCalendar(const Date& first, const Date& last,
+                                       unsigned weekendDays)
+        : BusinessCalendar(first, last, {}, weekendDays)
+    {}
+
+    BusinessCalendar::BusinessCalendar(const Date& first, const Date& last,
+                                       const std::vector<Date>& holidays,
+                                       unsigned weekendDays)
+    {
+        if (!isValid(first) || !isValid(last) || last < first)
+            YTIME_THROW("Invalid date range for business calendar.");
+
+        m_FirstDay = Detail::daysSinceEpochYMD(first);
+        m_DayCount = Detail::daysSinceEpochYMD(last) - m_FirstDay + 1;
+        /* There is always a word after the last day, countBefore can
+           therefore be used on the day after last. */
+        m_Words.resize(m_DayCount / 64 + 1);
+        for (uint32_t i = 0; i < m_DayCount; ++i)
+        {
+            auto weekday = Detail::getWeekdayIndex(m_FirstDay + i);
+            if ((weekendDays & (1u << weekday)) == 0)
+                m_Words[i / 64] |= uint64_t(1) << (i % 64);
+        }
+        for (auto& holiday : holidays)
+        {
+            auto i = getIndex(holiday);
+            m_Words[i / 64] &= ~(uint64_t(1) << (i % 64));
+        }
+        updateCounts();
+    }
+
+    Date BusinessCalendar::first() const
+    {
+        return Detail::toYMD(m_FirstDay);
+    }
+
+    Date BusinessCalendar::last() const
+    {
+        return Detail::toYMD(m_FirstDay + m_DayCount - 1);
+    }
+
+    void BusinessCalendar::addHoliday(const Date& date)
+    {
+        auto i = getIndex(date);
+        m_Words[i / 64] &= ~(uint64_t(1) << (i % 64));
+        updateCounts();
+    }
+
+    bool BusinessCalendar::isBusinessDay(const Date& date) const
+    {
+        auto i = getIndex(date);
+        return (m_Words[i / 64] >> (i % 64)) & 1u;
+    }
+
+    int64_t BusinessCalendar::businessDaysBetween(const Date& from,
+                                                  const Date& to) const
+    {
+        return countBefore(getIndex(to, true))
+               - countBefore(getIndex(from, true));
+    }
+
+    Date BusinessCalendar::addBusinessDays(const Date& date, int64_t days) const
+    {
+        if (days == 0)
+            return date;
+        auto i = getIndex(date);
+        /* n is the zero-based number of the resulting business day. */
+        auto n = days > 0 ? countBefore(i + 1) + days - 1
+                          : countBefore(i) + days;
+        return Detail::toYMD(m_FirstDay + findBusinessDay(n));
+    }
+
+    void BusinessCalendar::businessDaysBetween(const Date* from,
+                                               const Date* to,
+                                               size_t count,
+                                               int64_t* result) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            result[i] = businessDaysBetween(from[i], to[i]);
+    }
+
+    void BusinessCalendar::addBusinessDays(const Date* dates, size_t count,
+                                           int64_t days, Date* result) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            result[i] = addBusinessDays(dates[i], days);
+    }
+
+    uint32_t BusinessCalendar::getIndex(const Date& date, bool allowEnd) const
+    {
+        auto day = Detail::daysSinceEpochYMD(date);
+        auto end = m_FirstDay + m_DayCount + (allowEnd ? 1 : 0);
+        if (!isValid(date) || day < m_FirstDay || end <= day)
+            YTIME_THROW("Date is outside the business calendar.");
+        return day - m_FirstDay;
+    }
+
+    int64_t BusinessCalendar::countBefore(uint32_t index) const noexcept
+    {
+        auto mask = (uint64_t(1) << (index % 64)) - 1;
+        return m_Counts[index / 64] + popcount(m_Words[index / 64] & mask);
+    }
+
+    uint32_t BusinessCalendar::findBusinessDay(int64_t n) const
+    {
+        if (n < 0 || m_Counts.back() <= n)
+            YTIME_THROW("The result is outside the business calendar.");
+
+        auto it = std::upper_bound(m_Counts.begin(), m_Counts.end(), n);
+        auto word = size_t(std::distance(m_Counts.begin(), it)) - 1;
+        auto bits = m_Words[word];
+        for (auto k = n - m_Counts[word]; k > 0; --k)
+            bits &= bits - 1;
+        return uint32_t(word * 64 + countTrailingZeros(bits));
+    }
+
+    void BusinessCalendar::updateCounts() noexcept
+    {
+        m_Counts.resize(m_Words.size() + 1);
+        m_Counts[0] = 0;
+        for (size_t i = 0; i < m_Words.size(); ++i)
+            m_Counts[i + 1] = m_Counts[i] + popcount(m_Words[i]);
+    }
+}
@@ -0,0 +1,122 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/CalendarDelta.hpp"
+
+#include <ostream>
+#include "Ytime/LeapSeconds.hpp"
+#include "Ytime/Detail/LeapSecondTable.hpp"
+#include "InternalInstrumentation.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        /* month is an internal month, i.e. 0 is March and 11 is
+           February the following year. */
+        uint32_t getInternalDaysInMonth(int64_t year, int64_t month) noexcept
+        {
+            if (month == 11)
+                return isLeapYear(int(year + 1)) ? 29 : 28;
+            return Detail::ACCUMULATED_DAYS[month + 1]
+                   - Detail::ACCUMULATED_DAYS[month];
+        }
+
+        uint32_t addMonthsToDay(uint32_t day, int64_t months,
+                                MonthEndPolicy policy) noexcept
+        {
+            auto [year, dayOfYear] = Detail::toInternalYD(day);
+            auto it = std::upper_bound(std::begin(Detail::ACCUMULATED_DAYS),
+                                       std::end(Detail::ACCUMULATED_DAYS),
+                                       dayOfYear);
+            auto month = std::distance(std::begin(Detail::ACCUMULATED_DAYS),
+                                       it) - 1;
+            auto dayOfMonth = dayOfYear - Detail::ACCUMULATED_DAYS[month];
+            auto isLastDay =
+                dayOfMonth + 1 == getInternalDaysInMonth(year, month);
+
+            auto totalMonths = month + months;
+            auto yearDelta = Detail::floorDiv(totalMonths, 12);
+            auto newYear = int64_t(year) + yearDelta;
+            auto newMonth = totalMonths - yearDelta * 12;
+            auto daysInMonth = getInternalDaysInMonth(newYear, newMonth);
+            if (policy == MonthEndPolicy::END_OF_MONTH && isLastDay)
+                dayOfMonth = daysInMonth - 1;
+            else if (policy != MonthEndPolicy::ROLL_OVER
+                     && dayOfMonth >= daysInMonth)
+                dayOfMonth = daysInMonth - 1;
+            return Detail::daysSinceEpochY(uint32_t(newYear))
+                   + Detail::ACCUMULATED_DAYS[newMonth] + dayOfMonth;
+        }
+    }
+
+    std::ostream& operator<<(std::ostream& os, const CalendarDelta& d)
+    {
+        return os << d.months() << " months " << d.dateTimeDelta();
+    }
+
+    Date addMonths(const Date& date, int64_t months, MonthEndPolicy policy)
+    {
+        auto day = Detail::daysSinceEpochYMD(date);
+        return Detail::toYMD(addMonthsToDay(day, months, policy));
+    }
+
+    PackedDateTime add(PackedDateTime from, const CalendarDelta& delta,
+                       MonthEndPolicy policy)
+    {
+        if (delta.months() == 0)
+            return add(from, delta.dateTimeDelta());
+
+        auto& table = Detail::getLeapSecondData();
+        if (Detail::isLeapSecond(table, from))
+            YTIME_THROW("Can not count months from a leap second.");
+        auto [days, usecs] = Detail::unpackDaysUsecondsUtc(table, from);
+        auto newDays = addMonthsToDay(uint32_t(days), delta.months(), policy);
+        auto to = PackedDateTime(Detail::packDaysUseconds(newDays, usecs)
+                                 + Detail::getLeapSecondsForDay(table, newDays)
+                                   * USECS_PER_SEC);
+        return add(to, delta.dateTimeDelta());
+    }
+
+    CalendarDelta getCalendarDelta(PackedDateTime from, PackedDateTime to)
+    {
+        if (from == to)
+            return {};
+        if (isLeapSecond(from))
+            YTIME_THROW("Can not count months from a leap second.");
+
+        auto fromDate = unpackDate(from);
+        auto toDate = unpackDate(to);
+        int64_t months = (toDate.year - fromDate.year) * 12
+                         + toDate.month - fromDate.month;
+        auto mid = add(from, Months(months));
+        if (from < to && to < mid)
+            mid = add(from, Months(--months));
+        else if (to < from && mid < to)
+            mid = add(from, Months(++months));
+        return CalendarDelta(months, getDateTimeDelta(mid, to));
+    }
+
+    void add(const PackedDateTime* values, size_t count,
+             const CalendarDelta& delta, PackedDateTime* result,
+             MonthEndPolicy policy)
+    {
+        YTIME_TIME_BATCH(count);
+        for (size_t i = 0; i < count; ++i)
+            result[i] = add(values[i], delta, policy);
+    }
+
+    void makeSchedule(PackedDateTime start, const CalendarDelta& step,
+                      size_t count, PackedDateTime* result,
+                      MonthEndPolicy policy)
+    {
+        YTIME_TIME_BATCH(count);
+        for (size_t i = 0; i < count; ++i)
+            result[i] = add(start, step * int64_t(i), policy);
+    }
+}
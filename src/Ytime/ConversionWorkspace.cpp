@@ -0,0 +1,154 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/ConversionWorkspace.hpp"
+
+#include <algorithm>
+#include <utility>
+#include "InternalInstrumentation.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+        constexpr size_t alignUp(size_t n, size_t alignment) noexcept
+        {
+            return (n + alignment - 1) & ~(alignment - 1);
+        }
+    }
+
+    ConversionWorkspace::ConversionWorkspace() noexcept = default;
+
+    ConversionWorkspace::ConversionWorkspace(size_t capacity)
+        : m_Block(capacity != 0 ? new std::byte[capacity] : nullptr),
+          m_Capacity(capacity)
+    {}
+
+    /* The moved-from workspace must not keep a capacity without a
+       block, otherwise allocate would write through a null pointer. */
+    ConversionWorkspace::ConversionWorkspace(
+            ConversionWorkspace&& other) noexcept
+        : m_Block(std::move(other.m_Block)),
+          m_Capacity(std::exchange(other.m_Capacity, 0)),
+          m_Size(std::exchange(other.m_Size, 0)),
+          m_Overflow(std::move(other.m_Overflow))
+    {
+        other.m_Overflow.clear();
+    }
+
+    ConversionWorkspace::~ConversionWorkspace() = default;
+
+    ConversionWorkspace&
+    ConversionWorkspace::operator=(ConversionWorkspace&& other) noexcept
+    {
+        if (this != &other)
+        {
+            m_Block = std::move(other.m_Block);
+            m_Capacity = std::exchange(other.m_Capacity, 0);
+            m_Size = std::exchange(other.m_Size, 0);
+            m_Overflow = std::move(other.m_Overflow);
+            other.m_Overflow.clear();
+        }
+        return *this;
+    }
+
+    void ConversionWorkspace::reset()
+    {
+        if (!m_Overflow.empty())
+        {
+            /* Grow to the high-water mark, with some headroom to avoid
+               growing by a few bytes at a time. */
+            auto capacity = m_Size + m_Size / 2;
+            m_Overflow.clear();
+            m_Block.reset();
+            m_Block.reset(new std::byte[capacity]);
+            m_Capacity = capacity;
+        }
+        m_Size = 0;
+    }
+
+    size_t ConversionWorkspace::capacity() const noexcept
+    {
+        return m_Capacity;
+    }
+
+    size_t ConversionWorkspace::size() const noexcept
+    {
+        return m_Size;
+    }
+
+    void* ConversionWorkspace::allocateBytes(size_t size, size_t alignment)
+    {
+        auto offset = alignUp(m_Size, alignment);
+        if (offset + size <= m_Capacity)
+        {
+            m_Size = offset + size;
+            return m_Block.get() + offset;
+        }
+
+        /* The block is full, the allocation goes in a separate block
+           until the next reset. */
+        YTIME_COUNT(slowPaths);
+        auto overflowSize = alignUp(std::max<size_t>(size, 1), ALIGNMENT);
+        m_Overflow.emplace_back(new std::byte[overflowSize]);
+        m_Size += overflowSize;
+        return m_Overflow.back().get();
+    }
+
+    WorkspaceArray<std::string_view>
+    splitLines(std::string_view text, ConversionWorkspace& workspace)
+    {
+        auto count = size_t(std::count(text.begin(), text.end(), '\n'));
+        if (!text.empty() && text.back() != '\n')
+            ++count;
+
+        auto lines = workspace.allocate<std::string_view>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto pos = text.find('\n');
+            auto line = text.substr(0, pos);
+            text.remove_prefix(pos == std::string_view::npos
+                               ? text.size() : pos + 1);
+            if (!line.empty() && line.back() == '\r')
+                line.remove_suffix(1);
+            lines[i] = line;
+        }
+        return lines;
+    }
+
+    WorkspaceArray<PackedDateTime>
+    parseTimestamps(const std::string_view* values, size_t count,
+                    const TimestampParser& parser,
+                    PackedDateTime invalidValue,
+                    ConversionWorkspace& workspace)
+    {
+        YTIME_TIME_BATCH(count);
+        auto result = workspace.allocate<PackedDateTime>(count);
+        for (size_t i = 0; i < count; ++i)
+            result[i] = parser.parse(values[i]).value_or(invalidValue);
+        return result;
+    }
+
+    std::string_view
+    formatTimestamps(const PackedDateTime* values, size_t count,
+                     const DateTimeFormat& format, char separator,
+                     ConversionWorkspace& workspace)
+    {
+        YTIME_TIME_BATCH(count);
+        auto length = format.length();
+        auto buffer = workspace.allocate<char>(count * (length + 1));
+        auto pos = buffer.data();
+        for (size_t i = 0; i < count; ++i)
+        {
+            pos += format.format(values[i], pos, length);
+            *pos++ = separator;
+        }
+        return {buffer.data(), size_t(pos - buffer.data())};
+    }
+}
@@ -7,82 +7,128 @@
 //****************************************************************************
 #include "Ytime/DateTime.hpp"
 
+#include <charconv>
 #include <iomanip>
 #include <ostream>
-#include <vector>
 #include "Ytime/LeapSeconds.hpp"
-#include "InternalDateTimeMath.hpp"
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+#include "InternalInstrumentation.hpp"
 
 namespace Ytime
 {
     namespace
     {
-        std::vector<std::string_view>
-        splitString(std::string_view s, char delimiter, size_t maxSplit)
+        template <size_t N>
+        bool splitString(std::string_view s, char delimiter,
+                         std::string_view (& parts)[N])
         {
-            if (maxSplit == 0)
-                return {s};
-
-            std::vector<std::string_view> result;
-            size_t pos = 0;
-            while (true)
+            for (size_t i = 0; i + 1 < N; ++i)
             {
-                auto nextPos = s.find(delimiter, pos);
-                result.push_back(s.substr(pos, nextPos - pos));
-                if (nextPos == std::string_view::npos)
-                    break;
-                pos = nextPos + 1;
-                if (result.size() == maxSplit)
-                {
-                    result.push_back(s.substr(pos));
-                    break;
-                }
+                auto pos = s.find(delimiter);
+                if (pos == std::string_view::npos)
+                    return false;
+                parts[i] = s.substr(0, pos);
+                s = s.substr(pos + 1);
             }
-            return result;
+            parts[N - 1] = s;
+            return true;
         }
 
-        std::optional<long> parseLong(const std::string& str, int base = 10)
+        std::optional<int> parseInt(std::string_view str)
         {
-            char* endp = nullptr;
-            errno = 0;
-            auto value = strtol(str.c_str(), &endp, base);
-            if (endp == str.c_str() + str.size() && errno == 0)
+            int value = 0;
+            auto end = str.data() + str.size();
+            auto [ptr, ec] = std::from_chars(str.data(), end, value);
+            if (ptr == end && ec == std::errc())
                 return value;
             return {};
         }
 
-        std::optional<long> parseFraction(const std::string& str, size_t digits)
+        std::optional<int> parseFraction(std::string_view str, size_t digits)
         {
-            auto n = parseLong(str);
-            if (!n)
+            if (str.empty())
                 return {};
-            if (str.size() == digits)
-                return n;
-
-            auto power = std::abs(int64_t(digits) - int64_t(str.size()));
-            long factor = 10;
-            for (int i = 1; i < power; ++i)
-                factor *= 10;
-            if (str.size() < digits)
-                return *n * factor;
-            return *n / factor;
+
+            int value = 0;
+            for (size_t i = 0; i < str.size(); ++i)
+            {
+                auto digit = unsigned(str[i]) - '0';
+                if (digit > 9)
+                    return {};
+                if (i < digits)
+                    value = value * 10 + int(digit);
+            }
+            for (size_t i = str.size(); i < digits; ++i)
+                value *= 10;
+            return value;
         }
 
-        constexpr bool isLeapYear(uint32_t year) noexcept
+        /* Removes a trailing "Z", "+hh:mm", "+hhmm" or "+hh" (or the same
+           with '-') from str and returns the offset in minutes. */
+        std::optional<int> extractUtcOffset(std::string_view& str)
         {
-            return (year % 16 == 0) || (year % 4 == 0 && year % 25 != 0);
+            auto pos = str.find_first_of("Zz+-");
+            if (pos == std::string_view::npos)
+                return 0;
+
+            auto offset = str.substr(pos);
+            str = str.substr(0, pos);
+            if (offset.size() == 1 && (offset[0] == 'Z' || offset[0] == 'z'))
+                return 0;
+            /* Anything longer than a bare Z must start with a sign. */
+            if (offset[0] != '+' && offset[0] != '-')
+                return {};
+
+            std::string_view hh = offset.substr(1, 2), mm;
+            if (offset.size() == 6 && offset[3] == ':')
+                mm = offset.substr(4);
+            else if (offset.size() == 5)
+                mm = offset.substr(3);
+            else if (offset.size() != 3)
+                return {};
+
+            auto h = parseFraction(hh, 2);
+            auto m = mm.empty() ? std::optional<int>(0) : parseFraction(mm, 2);
+            if (!h || !m || 23 < *h || 59 < *m)
+                return {};
+            auto minutes = *h * 60 + *m;
+            return offset[0] == '-' ? -minutes : minutes;
         }
 
-        int getDaysInMonth(int year, int month)
+        /* Converts a local date and time to UTC. Only hours and minutes
+           are adjusted, a leap second therefore remains second 60 and
+           is validated as UTC afterwards. */
+        std::optional<DateTime> toUtc(DateTime dt, int offsetMinutes)
         {
-            constexpr int DAYS[12] = {
-                31, 0, 31, 30, 31, 30,
-                31, 31, 30, 31, 30, 31};
-            if (month < 1 || 12 < month)
-                return 0;
-            if (month != 2)
-                return DAYS[month - 1];
-            return isLeapYear(year) ? 29 : 28;
+            if (offsetMinutes == 0)
+                return dt;
+            /* The local time must be valid before it's shifted,
+               otherwise e.g. 25:00+01:00 would be normalized to a valid
+               UTC time. */
+            auto& t = dt.time;
+            if (!isValid(dt.date)
+                || t.hour < 0 || 23 < t.hour || t.minute < 0 || 59 < t.minute
+                || t.second < 0 || 60 < t.second)
+            {
+                return {};
+            }
+
+            auto minutes = dt.time.hour * 60 + dt.time.minute - offsetMinutes;
+            auto days = int64_t(Detail::daysSinceEpochYMD(dt.date));
+            while (minutes < 0)
+            {
+                minutes += 24 * 60;
+                --days;
+            }
+            while (minutes >= 24 * 60)
+            {
+                minutes -= 24 * 60;
+                ++days;
+            }
+            dt.date = Detail::toYMD(uint64_t(days));
+            dt.time.hour = minutes / 60;
+            dt.time.minute = minutes % 60;
+            return dt;
         }
     }
 
@@ -223,12 +269,12 @@ namespace Ytime
 
     std::optional<Date> parseDate(std::string_view str)
     {
-        auto parts = splitString(str, '-', 2);
-        if (parts.size() != 3)
+        std::string_view parts[3];
+        if (!splitString(str, '-', parts))
             return {};
-        auto y = parseLong(std::string(parts[0]));
-        auto m = parseLong(std::string(parts[1]));
-        auto d = parseLong(std::string(parts[2]));
+        auto y = parseInt(parts[0]);
+        auto m = parseInt(parts[1]);
+        auto d = parseInt(parts[2]);
         if (y && m && d)
             return Date(*y, *m, *d);
         return {};
@@ -236,45 +282,69 @@ namespace Ytime
 
     std::optional<Time> parseTime(std::string_view str)
     {
-        auto parts1 = splitString(str, '.', 1);
-        auto parts2 = splitString(parts1[0], ':', 2);
-        if (parts2.size() != 3)
+        std::string_view fraction;
+        if (auto dot = str.find('.'); dot != std::string_view::npos)
+        {
+            fraction = str.substr(dot + 1);
+            str = str.substr(0, dot);
+            if (fraction.empty())
+                return {};
+        }
+
+        std::string_view parts[3];
+        if (!splitString(str, ':', parts))
             return {};
-        auto h = parseLong(std::string(parts2[0]));
-        auto m = parseLong(std::string(parts2[1]));
-        auto s = parseLong(std::string(parts2[2]));
-        auto u = parts1.size() == 2
-                 ? parseFraction(std::string(parts1[1]), 6)
-                 : std::optional<long>(0);
+        auto h = parseInt(parts[0]);
+        auto m = parseInt(parts[1]);
+        auto s = parseInt(parts[2]);
+        auto u = !fraction.empty()
+                 ? parseFraction(fraction, 6)
+                 : std::optional<int>(0);
 
         if (h && m && s && u)
-            return Time(int(*h), int(*m), int(*s), int(*u));
+            return Time(*h, *m, *s, *u);
         return {};
     }
 
     std::optional<DateTime> parseDateTime(std::string_view str)
     {
-        auto t = str.find('T');
+        YTIME_COUNT(calls);
+        auto result = parseDateTimeAndOffset(str);
+        if (result)
+            return result->first;
+        YTIME_COUNT(parseFailures);
+        return {};
+    }
+
+    std::optional<std::pair<DateTime, int>>
+    parseDateTimeAndOffset(std::string_view str)
+    {
+        auto t = str.find_first_of("Tt ");
         if (t != std::string_view::npos)
         {
+            auto timeStr = str.substr(t + 1);
+            auto offset = extractUtcOffset(timeStr);
             auto ymd = parseDate(str.substr(0, t));
-            auto hms = parseTime(str.substr(t + 1));
-            if (ymd && hms)
-                return DateTime(*ymd, *hms);
-            return {};
+            auto hms = parseTime(timeStr);
+            if (!offset || !ymd || !hms)
+                return {};
+            auto utc = toUtc(DateTime(*ymd, *hms), *offset);
+            if (!utc)
+                return {};
+            return std::pair(*utc, *offset);
         }
         else if (str.find('-') != std::string_view::npos)
         {
             auto ymd = parseDate(str);
             if (ymd)
-                return DateTime(*ymd, {});
+                return std::pair(DateTime(*ymd, {}), 0);
             return {};
         }
         else
         {
             auto hms = parseTime(str);
             if (hms)
-                return DateTime({}, *hms);
+                return std::pair(DateTime({}, *hms), 0);
             return {};
         }
     }
@@ -321,6 +391,36 @@ namespace Ytime
         return validate(dateTime.time, hasLeapSecond(dateTime.date));
     }
 
+    bool isValid(const Date& date) noexcept
+    {
+        return date.year >= int(MIN_YEAR)
+               && 1 <= date.day
+               && date.day <= getDaysInMonth(date.year, date.month);
+    }
+
+    bool isValid(const Time& time, bool allowLeapSecond) noexcept
+    {
+        if (time.hour < 0 || 23 < time.hour
+            || time.minute < 0 || 59 < time.minute
+            || time.usecond < 0 || 1000000 <= time.usecond)
+        {
+            return false;
+        }
+        if (0 <= time.second && time.second <= 59)
+            return true;
+        return allowLeapSecond && time.second == 60
+               && time.hour == 23 && time.minute == 59;
+    }
+
+    bool isValid(const DateTime& dateTime) noexcept
+    {
+        if (!isValid(dateTime.date))
+            return false;
+        if (dateTime.time.second != 60)
+            return isValid(dateTime.time);
+        return isValid(dateTime.time, hasLeapSecond(dateTime.date));
+    }
+
     DateTime getCurrentDateTime()
     {
         time_t t = time(nullptr);
@@ -332,12 +432,44 @@ namespace Ytime
     DateYD toYearDay(const Date& date)
     {
         Date date0 = {date.year, 1, 1};
-        auto day = daysSinceEpochYMD(date) - daysSinceEpochYMD(date0);
+        auto day = Detail::daysSinceEpochYMD(date)
+                   - Detail::daysSinceEpochYMD(date0);
         return {date.year, int(day + 1)};
     }
 
     Date toYearMonthDay(const DateYD& date)
     {
-        return toYMD(daysSinceEpochYMD({date.year, 1, 1}) + date.day - 1);
+        auto jan1 = Detail::daysSinceEpochYMD({date.year, 1, 1});
+        return Detail::toYMD(jan1 + date.day - 1);
+    }
+
+    int getWeekday(const Date& date)
+    {
+        auto day = Detail::daysSinceEpochYMD(date);
+        return int(Detail::getWeekdayIndex(day)) + 1;
+    }
+
+    DateYWD toYearWeekDay(const Date& date)
+    {
+        auto days = Detail::daysSinceEpochYMD(date);
+        auto weekday = Detail::getWeekdayIndex(days);
+        /* The week belongs to the year its Thursday is in. */
+        auto thursday = days - weekday + 3;
+        auto year = date.year;
+        if (thursday < Detail::daysSinceEpochYMD({year, 1, 1}))
+            --year;
+        else if (thursday >= Detail::daysSinceEpochYMD({year + 1, 1, 1}))
+            ++year;
+        auto jan1 = Detail::daysSinceEpochYMD({year, 1, 1});
+        auto week = (thursday - jan1) / 7 + 1;
+        return {year, int(week), int(weekday) + 1};
+    }
+
+    Date toYearMonthDay(const DateYWD& date)
+    {
+        /* January 4th is always in week 1. */
+        auto jan4 = Detail::daysSinceEpochYMD({date.year, 1, 4});
+        auto monday = jan4 - Detail::getWeekdayIndex(jan4);
+        return Detail::toYMD(monday + (date.week - 1) * 7 + date.weekday - 1);
     }
 }
@@ -0,0 +1,97 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/DateTimeFormat.hpp"
+
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    std::optional<DateTime>
+    DateTimeFormat::parseDateTime(std::string_view str) const noexcept
+    {
+        auto dt = parseFields(str);
+        if (!dt)
+            return {};
+        return validateFields(*dt);
+    }
+
+    std::optional<DateTime>
+    DateTimeFormat::validateFields(const DateTime& fields) const noexcept
+    {
+        auto dt = fields;
+        if (hasField(FormatField::DAY_OF_YEAR))
+        {
+            /* The day-of-year conversion only works for the years
+               that isValid accepts. */
+            if (!hasField(FormatField::YEAR)
+                || dt.date.year < int(MIN_YEAR) || dt.date.day < 1
+                || dt.date.day > (isLeapYear(dt.date.year) ? 366 : 365))
+            {
+                return {};
+            }
+            dt.date = toYearMonthDay({dt.date.year, dt.date.day});
+        }
+
+        if (!hasField(FormatField::YEAR))
+        {
+            if (!isValid(dt.time, true))
+                return {};
+            return dt;
+        }
+
+        if (!isValid(dt))
+            return {};
+        return dt;
+    }
+
+    std::optional<PackedDateTime>
+    DateTimeFormat::parse(std::string_view str) const noexcept
+    {
+        auto dt = parseDateTime(str);
+        if (!dt || dt->date.year == 0)
+            return {};
+        return pack(*dt);
+    }
+
+    size_t DateTimeFormat::format(const DateTime& dateTime,
+                                  char* buffer, size_t bufferSize) const noexcept
+    {
+        if (bufferSize < m_Length)
+            return 0;
+
+        auto s = buffer;
+        for (auto& instr : *this)
+        {
+            if (instr.field == FormatField::LITERAL)
+            {
+                *s++ = instr.literal;
+                continue;
+            }
+            auto value = Detail::getFormatField(dateTime, instr);
+            s = Detail::writeFormatDigits(s, value, instr.width);
+            if (!s)
+                return 0;
+        }
+        return size_t(s - buffer);
+    }
+
+    size_t DateTimeFormat::format(PackedDateTime dateTime,
+                                  char* buffer, size_t bufferSize) const noexcept
+    {
+        return format(unpack(dateTime), buffer, bufferSize);
+    }
+
+    std::string DateTimeFormat::format(PackedDateTime dateTime) const
+    {
+        std::string result(m_Length, '\0');
+        if (format(dateTime, result.data(), result.size()) != m_Length)
+            YTIME_THROW("The date and time doesn't fit in the format.");
+        return result;
+    }
+}
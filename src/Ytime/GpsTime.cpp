@@ -0,0 +1,59 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/GpsTime.hpp"
+
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        /* TAI - UTC was 19 seconds at the GPS epoch, 9 of them are leap
+           seconds that are counted by PackedDateTime. */
+        constexpr int64_t GPS_EPOCH =
+            int64_t(Detail::packInternalDateTime({{1980, 1, 6}, {0, 0, 0}}))
+            + 9 * int64_t(USECS_PER_SEC);
+    }
+
+    int64_t toGpsTimeUsecs(PackedDateTime dateTime) noexcept
+    {
+        return int64_t(dateTime) - GPS_EPOCH;
+    }
+
+    PackedDateTime fromGpsTimeUsecs(int64_t usecs) noexcept
+    {
+        return PackedDateTime(usecs + GPS_EPOCH);
+    }
+
+    GpsTime toGpsTime(PackedDateTime dateTime) noexcept
+    {
+        auto usecs = toGpsTimeUsecs(dateTime);
+        auto week = Detail::floorDiv(usecs, USECS_PER_GPS_WEEK);
+        return {week, usecs - week * USECS_PER_GPS_WEEK};
+    }
+
+    PackedDateTime fromGpsTime(const GpsTime& gpsTime) noexcept
+    {
+        return fromGpsTimeUsecs(gpsTime.week * USECS_PER_GPS_WEEK
+                                + gpsTime.usecs);
+    }
+
+    void toGpsTimeUsecs(const PackedDateTime* values, size_t count,
+                        int64_t* result) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+            result[i] = int64_t(values[i]) - GPS_EPOCH;
+    }
+
+    void fromGpsTimeUsecs(const int64_t* values, size_t count,
+                          PackedDateTime* result) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+            result[i] = PackedDateTime(values[i] + GPS_EPOCH);
+    }
+}
@@ -0,0 +1,182 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/Instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "InternalInstrumentation.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        template <typename A, typename B, typename Func>
+        void forEachCounter(A& a, B& b, Func func)
+        {
+            func(a.calls, b.calls);
+            func(a.slowPaths, b.slowPaths);
+            func(a.leapSecondHits, b.leapSecondHits);
+            func(a.parseFailures, b.parseFailures);
+            func(a.throws, b.throws);
+            func(a.batchCalls, b.batchCalls);
+            func(a.batchValues, b.batchValues);
+            func(a.sampledBatches, b.sampledBatches);
+            func(a.sampledBatchNsecs, b.sampledBatchNsecs);
+        }
+
+        std::atomic<uint32_t> batchSamplingInterval{64};
+    }
+
+    InstrumentationCounters& operator+=(InstrumentationCounters& a,
+                                        const InstrumentationCounters& b) noexcept
+    {
+        forEachCounter(a, b, [](uint64_t& x, uint64_t y) {x += y;});
+        return a;
+    }
+
+    InstrumentationCounters operator+(InstrumentationCounters a,
+                                      const InstrumentationCounters& b) noexcept
+    {
+        return a += b;
+    }
+
+    InstrumentationCounters operator-(InstrumentationCounters a,
+                                      const InstrumentationCounters& b) noexcept
+    {
+        forEachCounter(a, b, [](uint64_t& x, uint64_t y) {x -= y;});
+        return a;
+    }
+
+    void setBatchSamplingInterval(uint32_t interval) noexcept
+    {
+        batchSamplingInterval.store(interval, std::memory_order_relaxed);
+    }
+
+#ifdef YTIME_INSTRUMENTATION
+
+    namespace
+    {
+        InstrumentationCounters read(const ThreadCounters& counters) noexcept
+        {
+            InstrumentationCounters result;
+            forEachCounter(result, counters,
+                           [](uint64_t& x, const std::atomic<uint64_t>& y)
+                           {x = y.load(std::memory_order_relaxed);});
+            return result;
+        }
+
+        struct Registry
+        {
+            std::mutex mutex;
+            std::vector<const ThreadCounters*> threads;
+            /* The sum of the counters of the threads that have finished. */
+            InstrumentationCounters finished;
+            /* The sum of all counters at the last reset. */
+            InstrumentationCounters baseline;
+        };
+
+        /* The registry is never destroyed, threads can finish after
+           static destruction has started. */
+        Registry& getRegistry()
+        {
+            static auto registry = new Registry;
+            return *registry;
+        }
+
+        InstrumentationCounters getTotal(const Registry& registry) noexcept
+        {
+            auto result = registry.finished;
+            for (auto counters : registry.threads)
+                result += read(*counters);
+            return result;
+        }
+
+        struct ThreadRegistration
+        {
+            ThreadRegistration()
+            {
+                auto& registry = getRegistry();
+                std::lock_guard lock(registry.mutex);
+                registry.threads.push_back(&counters);
+            }
+
+            ~ThreadRegistration()
+            {
+                auto& registry = getRegistry();
+                std::lock_guard lock(registry.mutex);
+                registry.finished += read(counters);
+                auto& threads = registry.threads;
+                threads.erase(std::find(threads.begin(), threads.end(),
+                                        &counters));
+            }
+
+            ThreadCounters counters;
+        };
+    }
+
+    ThreadCounters& getThreadCounters() noexcept
+    {
+        thread_local ThreadRegistration registration;
+        return registration.counters;
+    }
+
+    uint32_t getBatchSamplingInterval() noexcept
+    {
+        return batchSamplingInterval.load(std::memory_order_relaxed);
+    }
+
+    bool isInstrumentationEnabled() noexcept
+    {
+        return true;
+    }
+
+    InstrumentationCounters getInstrumentationCounters()
+    {
+        auto& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+        return getTotal(registry) - registry.baseline;
+    }
+
+    InstrumentationCounters getThreadInstrumentationCounters() noexcept
+    {
+        return read(getThreadCounters());
+    }
+
+    void resetInstrumentationCounters()
+    {
+        /* Only the owning thread writes to a thread's counters, the
+           reset is therefore done by remembering the current sums. */
+        auto& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+        registry.baseline = getTotal(registry);
+    }
+
+#else
+
+    bool isInstrumentationEnabled() noexcept
+    {
+        return false;
+    }
+
+    InstrumentationCounters getInstrumentationCounters()
+    {
+        return {};
+    }
+
+    InstrumentationCounters getThreadInstrumentationCounters() noexcept
+    {
+        return {};
+    }
+
+    void resetInstrumentationCounters()
+    {}
+
+#endif
+}
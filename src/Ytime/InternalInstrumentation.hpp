@@ -0,0 +1,99 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+/* YTIME_COUNT(name) increments a counter in the calling thread's
+   InstrumentationCounters, YTIME_TIME_BATCH(count) counts a batch call
+   and times it if it is sampled. Both expand to nothing unless
+   YTIME_INSTRUMENTATION is defined. */
+
+#ifdef YTIME_INSTRUMENTATION
+
+#include <atomic>
+#include <chrono>
+#include "Ytime/Instrumentation.hpp"
+
+namespace Ytime
+{
+    /* The counters of a single thread. Only the owning thread writes to
+       them, the atomics make it safe for other threads to read them. */
+    struct alignas(64) ThreadCounters
+    {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> slowPaths{0};
+        std::atomic<uint64_t> leapSecondHits{0};
+        std::atomic<uint64_t> parseFailures{0};
+        std::atomic<uint64_t> throws{0};
+        std::atomic<uint64_t> batchCalls{0};
+        std::atomic<uint64_t> batchValues{0};
+        std::atomic<uint64_t> sampledBatches{0};
+        std::atomic<uint64_t> sampledBatchNsecs{0};
+    };
+
+    ThreadCounters& getThreadCounters() noexcept;
+
+    uint32_t getBatchSamplingInterval() noexcept;
+
+    /* A plain load and store rather than fetch_add, there is only one
+       writer. */
+    inline void addToCounter(std::atomic<uint64_t>& counter,
+                             uint64_t n) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + n,
+                      std::memory_order_relaxed);
+    }
+
+    class BatchTimer
+    {
+    public:
+        explicit BatchTimer(size_t count) noexcept
+            : m_Counters(getThreadCounters())
+        {
+            auto calls = m_Counters.batchCalls.load(std::memory_order_relaxed);
+            addToCounter(m_Counters.batchCalls, 1);
+            addToCounter(m_Counters.batchValues, count);
+            auto interval = getBatchSamplingInterval();
+            m_Sampled = interval != 0 && calls % interval == 0;
+            if (m_Sampled)
+                m_Start = std::chrono::steady_clock::now();
+        }
+
+        BatchTimer(const BatchTimer&) = delete;
+
+        BatchTimer& operator=(const BatchTimer&) = delete;
+
+        ~BatchTimer()
+        {
+            if (!m_Sampled)
+                return;
+            auto elapsed = std::chrono::steady_clock::now() - m_Start;
+            addToCounter(m_Counters.sampledBatches, 1);
+            addToCounter(m_Counters.sampledBatchNsecs, uint64_t(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                    .count()));
+        }
+    private:
+        ThreadCounters& m_Counters;
+        bool m_Sampled = false;
+        std::chrono::steady_clock::time_point m_Start;
+    };
+}
+
+#define YTIME_COUNT(name) \
+    ::Ytime::addToCounter(::Ytime::getThreadCounters().name, 1)
+
+#define YTIME_TIME_BATCH(count) \
+    ::Ytime::BatchTimer ytimeBatchTimer_(count)
+
+#else
+
+#define YTIME_COUNT(name) ((void)0)
+
+#define YTIME_TIME_BATCH(count) ((void)0)
+
+#endif
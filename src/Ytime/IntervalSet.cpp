@@ -0,0 +1,201 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/IntervalSet.hpp"
+
+#include <algorithm>
+
+namespace Ytime
+{
+    namespace
+    {
+        /* Walks the endpoints of both sets in order and emits an endpoint
+           whenever pred(insideA, insideB) changes. */
+        template <typename Pred>
+        std::vector<PackedDateTime> combine(const std::vector<PackedDateTime>& a,
+                                            const std::vector<PackedDateTime>& b,
+                                            Pred pred)
+        {
+            std::vector<PackedDateTime> result;
+            result.reserve(a.size() + b.size());
+            size_t i = 0, j = 0;
+            bool inA = false, inB = false, inResult = false;
+            while (i < a.size() || j < b.size())
+            {
+                auto t = j == b.size() || (i < a.size() && a[i] < b[j])
+                         ? a[i] : b[j];
+                if (i < a.size() && a[i] == t)
+                {
+                    inA = !inA;
+                    ++i;
+                }
+                if (j < b.size() && b[j] == t)
+                {
+                    inB = !inB;
+                    ++j;
+                }
+                if (pred(inA, inB) != inResult)
+                {
+                    inResult = !inResult;
+                    result.push_back(t);
+                }
+            }
+            return result;
+        }
+    }
+
+    IntervalSet::IntervalSet(std::vector<Interval> intervals)
+    {
+        std::sort(intervals.begin(), intervals.end());
+
+        /* Merge in place, then copy the endpoints. */
+        size_t n = 0;
+        for (auto& interval : intervals)
+        {
+            if (!(interval.first < interval.second))
+                continue;
+            if (n != 0 && interval.first <= intervals[n - 1].second)
+                intervals[n - 1].second = std::max(intervals[n - 1].second,
+                                                   interval.second);
+            else
+                intervals[n++] = interval;
+        }
+
+        m_Endpoints.reserve(2 * n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            m_Endpoints.push_back(intervals[i].first);
+            m_Endpoints.push_back(intervals[i].second);
+        }
+    }
+
+    IntervalSet::IntervalSet(const Interval* intervals, size_t count)
+        : IntervalSet(std::vector<Interval>(intervals, intervals + count))
+    {}
+
+    bool IntervalSet::empty() const noexcept
+    {
+        return m_Endpoints.empty();
+    }
+
+    size_t IntervalSet::size() const noexcept
+    {
+        return m_Endpoints.size() / 2;
+    }
+
+    Interval IntervalSet::operator[](size_t i) const noexcept
+    {
+        return {m_Endpoints[2 * i], m_Endpoints[2 * i + 1]};
+    }
+
+    const std::vector<PackedDateTime>& IntervalSet::endpoints() const noexcept
+    {
+        return m_Endpoints;
+    }
+
+    void IntervalSet::insert(PackedDateTime start, PackedDateTime end)
+    {
+        if (!(start < end))
+            return;
+        m_Endpoints = combine(m_Endpoints, {start, end},
+                              [](bool a, bool b) {return a || b;});
+    }
+
+    bool IntervalSet::contains(PackedDateTime dateTime) const noexcept
+    {
+        auto it = std::upper_bound(m_Endpoints.begin(), m_Endpoints.end(),
+                                   dateTime);
+        return (it - m_Endpoints.begin()) % 2 == 1;
+    }
+
+    void IntervalSet::contains(const PackedDateTime* values, size_t count,
+                               bool* result) const noexcept
+    {
+        auto begin = m_Endpoints.begin();
+        auto end = m_Endpoints.end();
+        auto pos = begin;
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto value = values[i];
+            if (pos != begin && value < *(pos - 1))
+            {
+                pos = std::upper_bound(begin, pos, value);
+            }
+            else
+            {
+                /* Gallop forward from the previous position. */
+                size_t step = 1;
+                auto lo = pos;
+                while (size_t(end - lo) > step && !(value < lo[step]))
+                {
+                    lo += step;
+                    step *= 2;
+                }
+                auto hi = size_t(end - lo) > step ? lo + step + 1 : end;
+                pos = std::upper_bound(lo, hi, value);
+            }
+            result[i] = (pos - begin) % 2 == 1;
+        }
+    }
+
+    DateTimeDelta IntervalSet::totalDuration() const noexcept
+    {
+        int64_t usecs = 0;
+        for (size_t i = 0; i < m_Endpoints.size(); i += 2)
+            usecs += int64_t(m_Endpoints[i + 1] - m_Endpoints[i]);
+        return Useconds(usecs);
+    }
+
+    IntervalSet unite(const IntervalSet& a, const IntervalSet& b)
+    {
+        IntervalSet result;
+        result.m_Endpoints = combine(a.m_Endpoints, b.m_Endpoints,
+                                     [](bool x, bool y) {return x || y;});
+        return result;
+    }
+
+    IntervalSet intersect(const IntervalSet& a, const IntervalSet& b)
+    {
+        IntervalSet result;
+        result.m_Endpoints = combine(a.m_Endpoints, b.m_Endpoints,
+                                     [](bool x, bool y) {return x && y;});
+        return result;
+    }
+
+    IntervalSet subtract(const IntervalSet& a, const IntervalSet& b)
+    {
+        IntervalSet result;
+        result.m_Endpoints = combine(a.m_Endpoints, b.m_Endpoints,
+                                     [](bool x, bool y) {return x && !y;});
+        return result;
+    }
+
+    bool operator==(const IntervalSet& a, const IntervalSet& b) noexcept
+    {
+        return a.endpoints() == b.endpoints();
+    }
+
+    bool operator!=(const IntervalSet& a, const IntervalSet& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    IntervalSet operator|(const IntervalSet& a, const IntervalSet& b)
+    {
+        return unite(a, b);
+    }
+
+    IntervalSet operator&(const IntervalSet& a, const IntervalSet& b)
+    {
+        return intersect(a, b);
+    }
+
+    IntervalSet operator-(const IntervalSet& a, const IntervalSet& b)
+    {
+        return subtract(a, b);
+    }
+}
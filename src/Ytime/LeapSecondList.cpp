@@ -0,0 +1,337 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/LeapSeconds.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include "Ytime/Detail/LeapSecondTable.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        using Sha1Digest = std::array<uint32_t, 5>;
+
+        uint32_t rotateLeft(uint32_t value, unsigned bits) noexcept
+        {
+            return (value << bits) | (value >> (32u - bits));
+        }
+
+        Sha1Digest sha1(std::string_view data)
+        {
+            Sha1Digest h = {0x67452301u, 0xEFCDAB89u, 0x98BADCFEu,
+                            0x10325476u, 0xC3D2E1F0u};
+
+            std::string message(data);
+            message.push_back(char(0x80));
+            while (message.size() % 64 != 56)
+                message.push_back(0);
+            auto bits = uint64_t(data.size()) * 8;
+            for (int i = 7; i >= 0; --i)
+                message.push_back(char(bits >> (8u * unsigned(i))));
+
+            for (size_t chunk = 0; chunk < message.size(); chunk += 64)
+            {
+                uint32_t w[80];
+                for (size_t i = 0; i < 16; ++i)
+                {
+                    auto p = reinterpret_cast<const unsigned char*>(
+                        message.data() + chunk + i * 4);
+                    w[i] = uint32_t(p[0]) << 24u | uint32_t(p[1]) << 16u
+                           | uint32_t(p[2]) << 8u | uint32_t(p[3]);
+                }
+                for (size_t i = 16; i < 80; ++i)
+                    w[i] = rotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+                auto a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+                for (size_t i = 0; i < 80; ++i)
+                {
+                    uint32_t f, k;
+                    if (i < 20)
+                    {
+                        f = (b & c) | (~b & d);
+                        k = 0x5A827999u;
+                    }
+                    else if (i < 40)
+                    {
+                        f = b ^ c ^ d;
+                        k = 0x6ED9EBA1u;
+                    }
+                    else if (i < 60)
+                    {
+                        f = (b & c) | (b & d) | (c & d);
+                        k = 0x8F1BBCDCu;
+                    }
+                    else
+                    {
+                        f = b ^ c ^ d;
+                        k = 0xCA62C1D6u;
+                    }
+                    auto temp = rotateLeft(a, 5) + f + e + k + w[i];
+                    e = d;
+                    d = c;
+                    c = rotateLeft(b, 30);
+                    b = a;
+                    a = temp;
+                }
+                h[0] += a;
+                h[1] += b;
+                h[2] += c;
+                h[3] += d;
+                h[4] += e;
+            }
+            return h;
+        }
+
+        std::string_view trim(std::string_view s) noexcept
+        {
+            auto first = s.find_first_not_of(" \t\r");
+            if (first == std::string_view::npos)
+                return {};
+            auto last = s.find_last_not_of(" \t\r");
+            return s.substr(first, last + 1 - first);
+        }
+
+        /* Removes and returns the first whitespace-separated token. */
+        std::string_view nextToken(std::string_view& s) noexcept
+        {
+            s = trim(s);
+            auto end = s.find_first_of(" \t");
+            auto token = s.substr(0, end);
+            s = end == std::string_view::npos ? std::string_view() : s.substr(end);
+            return token;
+        }
+
+        template <typename T>
+        T parseNumber(std::string_view s, int base = 10)
+        {
+            T value = {};
+            auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(),
+                                             value, base);
+            if (ec != std::errc() || ptr != s.data() + s.size() || s.empty())
+                YTIME_THROW("Invalid number in leap second list: "
+                            + std::string(s));
+            return value;
+        }
+
+        constexpr uint32_t NTP_EPOCH_DAYS =
+            Detail::daysSinceEpochYMD({1900, 1, 1});
+
+        uint32_t ntpToDay(uint64_t ntpSecs)
+        {
+            if (ntpSecs % SECS_PER_DAY != 0)
+                YTIME_THROW("Leap second list time is not at midnight: "
+                            + std::to_string(ntpSecs));
+            return NTP_EPOCH_DAYS + uint32_t(ntpSecs / SECS_PER_DAY);
+        }
+
+        struct LoadedLeapSecondData
+        {
+            std::vector<Detail::LeapSecond> entries;
+            std::vector<int64_t> packedBounds;
+            std::vector<int64_t> unixBounds;
+            Detail::LeapSecondData data;
+        };
+
+        std::unique_ptr<LoadedLeapSecondData> parseLeapSecondList(std::string_view text)
+        {
+            std::string hashInput;
+            std::string updated, expires;
+            std::optional<Sha1Digest> hash;
+            std::vector<std::pair<uint64_t, int>> values;
+
+            while (!text.empty())
+            {
+                auto eol = text.find('\n');
+                auto line = trim(text.substr(0, eol));
+                text = eol == std::string_view::npos
+                       ? std::string_view() : text.substr(eol + 1);
+
+                if (line.size() >= 2 && line[0] == '#'
+                    && (line[1] == '$' || line[1] == '@'))
+                {
+                    auto rest = line.substr(2);
+                    auto value = nextToken(rest);
+                    parseNumber<uint64_t>(value);
+                    (line[1] == '$' ? updated : expires) = std::string(value);
+                }
+                else if (line.size() >= 2 && line[0] == '#' && line[1] == 'h')
+                {
+                    auto rest = line.substr(2);
+                    Sha1Digest digest = {};
+                    for (auto& word : digest)
+                        word = parseNumber<uint32_t>(nextToken(rest), 16);
+                    hash = digest;
+                }
+                else if (!line.empty() && line[0] != '#')
+                {
+                    auto rest = line.substr(0, line.find('#'));
+                    auto ntp = nextToken(rest);
+                    auto tai = nextToken(rest);
+                    values.emplace_back(parseNumber<uint64_t>(ntp),
+                                        parseNumber<int>(tai));
+                    hashInput.append(ntp).append(tai);
+                }
+            }
+
+            if (updated.empty() || expires.empty() || !hash || values.empty())
+                YTIME_THROW("The leap second list is incomplete.");
+            if (sha1(updated + expires + hashInput) != *hash)
+                YTIME_THROW("The leap second list's hash doesn't match its contents.");
+
+            auto result = std::make_unique<LoadedLeapSecondData>();
+            auto baseOffset = values.front().second;
+            for (size_t i = 1; i < values.size(); ++i)
+            {
+                if (values[i].second != values[i - 1].second + 1
+                    || values[i].first <= values[i - 1].first)
+                {
+                    YTIME_THROW("Only positive leap seconds are supported.");
+                }
+                auto day = ntpToDay(values[i].first);
+                auto leapSecs = uint32_t(values[i].second - baseOffset);
+                result->entries.push_back(Detail::makeLeapSecondTuple(
+                    {Detail::toYMD(day), {0, 0, int(leapSecs)}}, leapSecs));
+                result->packedBounds.push_back(
+                    int64_t(std::get<0>(result->entries.back())));
+                result->unixBounds.push_back(
+                    (int64_t(day) - Detail::UNIX_EPOCH_DAYS)
+                    * int64_t(USECS_PER_DAY));
+            }
+
+            auto& builtIn = Detail::getBuiltInLeapSecondData();
+            if (result->entries.size() < builtIn.size
+                || !std::equal(builtIn.entries, builtIn.entries + builtIn.size,
+                               result->entries.begin()))
+            {
+                YTIME_THROW("The leap second list doesn't match the built-in leap seconds.");
+            }
+
+            result->data = {
+                result->entries.data(),
+                result->packedBounds.data(),
+                result->unixBounds.data(),
+                result->entries.size(),
+                ntpToDay(parseNumber<uint64_t>(expires))
+            };
+            return result;
+        }
+
+        bool isSameTable(const Detail::LeapSecondData& a,
+                         const Detail::LeapSecondData& b) noexcept
+        {
+            return a.size == b.size && a.expirationDay == b.expirationDay
+                   && std::equal(a.entries, a.entries + a.size, b.entries);
+        }
+
+        /* Readers use a table for the duration of a single operation,
+           without any locking or reference counting. Replaced tables
+           are therefore kept for a grace period that is much longer
+           than any operation, and freed by a later call to
+           setLeapSecondList or resetLeapSecondList. */
+        constexpr auto GRACE_PERIOD = std::chrono::minutes(1);
+
+        using Clock = std::chrono::steady_clock;
+
+        struct RetiredLeapSecondData
+        {
+            std::unique_ptr<LoadedLeapSecondData> table;
+            Clock::time_point retired;
+        };
+
+        std::mutex g_LoadedMutex;
+        /* The loaded table that is currently published, if any. */
+        std::unique_ptr<LoadedLeapSecondData> g_CurrentTable;
+        std::vector<RetiredLeapSecondData> g_RetiredTables;
+
+        /* Publishes table, which is either the built-in table or
+           g_CurrentTable, retires the previous table and frees tables
+           whose grace period has passed. g_LoadedMutex must be locked. */
+        void publishAndRetire(const Detail::LeapSecondData& table,
+                              std::unique_ptr<LoadedLeapSecondData> previous)
+        {
+            auto now = Clock::now();
+            Detail::publishLeapSecondData(table);
+            if (previous)
+                g_RetiredTables.push_back({std::move(previous), now});
+            auto expired = [&](const RetiredLeapSecondData& t)
+            {
+                return now - t.retired >= GRACE_PERIOD;
+            };
+            g_RetiredTables.erase(std::remove_if(g_RetiredTables.begin(),
+                                                 g_RetiredTables.end(),
+                                                 expired),
+                                  g_RetiredTables.end());
+        }
+    }
+
+    void setLeapSecondList(std::string_view text)
+    {
+        auto table = parseLeapSecondList(text);
+        std::lock_guard lock(g_LoadedMutex);
+        if (isSameTable(table->data, Detail::getLeapSecondData()))
+            return;
+
+        /* A list that is loaded again, e.g. after a reset, reuses its
+           earlier table if it hasn't been freed yet. */
+        auto it = std::find_if(g_RetiredTables.begin(), g_RetiredTables.end(),
+                               [&](const RetiredLeapSecondData& t)
+                               {
+                                   return isSameTable(table->data,
+                                                      t.table->data);
+                               });
+        if (it != g_RetiredTables.end())
+        {
+            table = std::move(it->table);
+            g_RetiredTables.erase(it);
+        }
+
+        auto previous = std::move(g_CurrentTable);
+        g_CurrentTable = std::move(table);
+        publishAndRetire(g_CurrentTable->data, std::move(previous));
+    }
+
+    void loadLeapSecondList(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            YTIME_THROW("Can not open leap second list: " + path);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        setLeapSecondList(ss.str());
+    }
+
+    void resetLeapSecondList() noexcept
+    {
+        std::lock_guard lock(g_LoadedMutex);
+        publishAndRetire(Detail::getBuiltInLeapSecondData(),
+                         std::move(g_CurrentTable));
+    }
+
+    std::optional<Date> getLeapSecondListExpiration()
+    {
+        auto day = Detail::getLeapSecondData().expirationDay;
+        if (day == 0)
+            return {};
+        return Detail::toYMD(day);
+    }
+
+    bool isLeapSecondListExpired(PackedDateTime now) noexcept
+    {
+        auto day = Detail::getLeapSecondData().expirationDay;
+        return day != 0 && Detail::unpackDaysUsecondsUtc(now).first >= day;
+    }
+}
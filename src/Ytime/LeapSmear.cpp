@@ -0,0 +1,278 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/LeapSmear.hpp"
+
+#include <cmath>
+#include "Ytime/UnixTime.hpp"
+#include "Ytime/Detail/LeapSecondTable.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr int64_t SECOND = USECS_PER_SEC;
+        constexpr int64_t UNIX_EPOCH_USECS =
+            Detail::UNIX_EPOCH_DAYS * USECS_PER_DAY;
+        constexpr double PI = 3.14159265358979323846;
+
+        int64_t toUsecs(const DateTimeDelta& delta) noexcept
+        {
+            return delta.days() * int64_t(USECS_PER_DAY)
+                   + delta.totalUseconds();
+        }
+
+        /* The smear parameters in microseconds, and the current leap
+           second table.
+
+           Each leap second k has a window that starts at
+           unixBounds[k] - lead in smeared time and lasts duration. In
+           PackedDateTime the same window starts one second and lead
+           before packedBounds[k] and lasts duration plus one second. */
+        class Smear
+        {
+        public:
+            explicit Smear(const LeapSmear& smear)
+                : m_Duration(toUsecs(smear.duration)),
+                  m_Lead(toUsecs(smear.lead)),
+                  m_Shape(smear.shape),
+                  m_Table(Detail::getLeapSecondData())
+            {
+                if (m_Duration <= 0 || m_Lead < 0 || m_Lead > m_Duration)
+                    YTIME_THROW("Invalid leap second smear window.");
+            }
+
+            /* Returns the index of the leap second whose window in
+               PackedDateTime contains value, or -1. */
+            ptrdiff_t findPackedWindow(int64_t value) const noexcept
+            {
+                return findWindow(m_Table.packedBounds, value,
+                                  -SECOND - m_Lead, m_Duration - m_Lead);
+            }
+
+            /* Returns the index of the leap second whose window in
+               smeared time contains value, or -1. */
+            ptrdiff_t findSmearedWindow(int64_t value) const noexcept
+            {
+                return findWindow(m_Table.unixBounds, value,
+                                  -m_Lead, m_Duration - m_Lead);
+            }
+
+            int64_t toSmeared(PackedDateTime dateTime) const noexcept
+            {
+                auto k = findPackedWindow(int64_t(dateTime));
+                if (k < 0)
+                    return toUnixTimeUsecs(dateTime);
+                auto elapsed = int64_t(dateTime) - packedStart(k);
+                return smearedStart(k) + getSmeared(elapsed);
+            }
+
+            PackedDateTime fromSmeared(int64_t usecs) const noexcept
+            {
+                auto k = findSmearedWindow(usecs);
+                if (k < 0)
+                    return fromUnixTimeUsecs(usecs);
+                auto smeared = usecs - smearedStart(k);
+                return PackedDateTime(packedStart(k) + getElapsed(smeared));
+            }
+
+            /* Returns true if no value in [min, max] is inside a window
+               in bounds. */
+            bool isOutsideWindows(const int64_t* bounds, int64_t min,
+                                  int64_t max, int64_t before,
+                                  int64_t after) const noexcept
+            {
+                auto end = bounds + m_Table.size;
+                auto it = std::upper_bound(bounds, end, min - after);
+                return it == end || max < *it + before;
+            }
+
+            const int64_t* packedBounds() const noexcept
+            {
+                return m_Table.packedBounds;
+            }
+
+            const int64_t* unixBounds() const noexcept
+            {
+                return m_Table.unixBounds;
+            }
+
+            int64_t duration() const noexcept
+            {
+                return m_Duration;
+            }
+
+            int64_t lead() const noexcept
+            {
+                return m_Lead;
+            }
+        private:
+            ptrdiff_t findWindow(const int64_t* bounds, int64_t value,
+                                 int64_t before, int64_t after) const noexcept
+            {
+                /* The first window that ends after value. */
+                auto end = bounds + m_Table.size;
+                auto it = std::upper_bound(bounds, end, value - after);
+                if (it == end || value < *it + before)
+                    return -1;
+                return it - bounds;
+            }
+
+            int64_t packedStart(ptrdiff_t k) const noexcept
+            {
+                return m_Table.packedBounds[k] - SECOND - m_Lead;
+            }
+
+            int64_t smearedStart(ptrdiff_t k) const noexcept
+            {
+                return m_Table.unixBounds[k] - m_Lead;
+            }
+
+            /* Returns the elapsed time since the start of the window
+               when the smeared clock has advanced smeared microseconds. */
+            int64_t getElapsed(int64_t smeared) const noexcept
+            {
+                auto x = double(smeared) / double(m_Duration);
+                double fraction = m_Shape == SmearShape::LINEAR
+                                  ? x : (1 - std::cos(PI * x)) / 2;
+                return smeared + std::llround(fraction * SECOND);
+            }
+
+            /* The inverse of getElapsed, rounded down. */
+            int64_t getSmeared(int64_t elapsed) const noexcept
+            {
+                auto total = double(m_Duration + SECOND);
+                auto u = double(elapsed) * double(m_Duration) / total;
+                if (m_Shape == SmearShape::COSINE)
+                {
+                    /* Newton's method on u + SECOND * w(u / D) = elapsed. */
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        auto x = u / double(m_Duration);
+                        auto f = u + SECOND * (1 - std::cos(PI * x)) / 2
+                                 - double(elapsed);
+                        auto df = 1 + SECOND * PI * std::sin(PI * x)
+                                      / (2 * double(m_Duration));
+                        u -= f / df;
+                    }
+                }
+
+                auto result = std::clamp<int64_t>(std::llround(u), 0,
+                                                  m_Duration);
+                while (result > 0 && getElapsed(result) > elapsed)
+                    --result;
+                while (result < m_Duration && getElapsed(result + 1) <= elapsed)
+                    ++result;
+                return result;
+            }
+
+            int64_t m_Duration;
+            int64_t m_Lead;
+            SmearShape m_Shape;
+            const Detail::LeapSecondData& m_Table;
+        };
+
+        /* Converts blocks that lie outside every window with the plain
+           batch conversion, other blocks are converted one value at a
+           time. */
+        template <typename In, typename Out, typename KeyFunc,
+                  typename BatchFunc, typename ScalarFunc, typename OutsideFunc>
+        void convertSmearedBatch(const In* values, size_t count, Out* result,
+                                 KeyFunc key, BatchFunc convertBatch,
+                                 ScalarFunc convert, OutsideFunc isOutside)
+        {
+            constexpr size_t BLOCK_SIZE = 256;
+            for (size_t i = 0; i < count; i += BLOCK_SIZE)
+            {
+                auto n = std::min(BLOCK_SIZE, count - i);
+                auto min = key(values[i]), max = min;
+                for (size_t j = 1; j < n; ++j)
+                {
+                    min = std::min(min, key(values[i + j]));
+                    max = std::max(max, key(values[i + j]));
+                }
+
+                if (isOutside(min, max))
+                {
+                    convertBatch(values + i, n, result + i);
+                }
+                else
+                {
+                    for (size_t j = 0; j < n; ++j)
+                        result[i + j] = convert(values[i + j]);
+                }
+            }
+        }
+    }
+
+    int64_t toSmearedUnixTimeUsecs(PackedDateTime dateTime,
+                                   const LeapSmear& smear)
+    {
+        return Smear(smear).toSmeared(dateTime);
+    }
+
+    PackedDateTime fromSmearedUnixTimeUsecs(int64_t usecs,
+                                            const LeapSmear& smear)
+    {
+        return Smear(smear).fromSmeared(usecs);
+    }
+
+    void toSmearedUnixTimeUsecs(const PackedDateTime* values, size_t count,
+                                int64_t* result, const LeapSmear& smear)
+    {
+        Smear s(smear);
+        convertSmearedBatch(
+            values, count, result,
+            [](PackedDateTime t) {return int64_t(t);},
+            [](const PackedDateTime* v, size_t n, int64_t* r)
+            {toUnixTimeUsecs(v, n, r);},
+            [&](PackedDateTime t) {return s.toSmeared(t);},
+            [&](int64_t min, int64_t max)
+            {
+                return s.isOutsideWindows(s.packedBounds(), min, max,
+                                          -SECOND - s.lead(),
+                                          s.duration() - s.lead());
+            });
+    }
+
+    void fromSmearedUnixTimeUsecs(const int64_t* values, size_t count,
+                                  PackedDateTime* result,
+                                  const LeapSmear& smear)
+    {
+        Smear s(smear);
+        convertSmearedBatch(
+            values, count, result,
+            [](int64_t us) {return us;},
+            [](const int64_t* v, size_t n, PackedDateTime* r)
+            {fromUnixTimeUsecs(v, n, r);},
+            [&](int64_t us) {return s.fromSmeared(us);},
+            [&](int64_t min, int64_t max)
+            {
+                return s.isOutsideWindows(s.unixBounds(), min, max,
+                                          -s.lead(),
+                                          s.duration() - s.lead());
+            });
+    }
+
+    PackedDateTime packSmeared(const DateTime& dateTime,
+                               const LeapSmear& smear)
+    {
+        auto days = Detail::daysSinceEpochYMD(dateTime.date);
+        auto time = Detail::usecsSinceMidnight(dateTime.time);
+        auto usecs = int64_t(Detail::packDaysUseconds(days, time));
+        return fromSmearedUnixTimeUsecs(usecs - UNIX_EPOCH_USECS, smear);
+    }
+
+    DateTime unpackSmeared(PackedDateTime dateTime, const LeapSmear& smear)
+    {
+        auto usecs = toSmearedUnixTimeUsecs(dateTime, smear) + UNIX_EPOCH_USECS;
+        auto days = uint64_t(usecs) / USECS_PER_DAY;
+        return {Detail::toYMD(days),
+                Detail::toHMS(uint64_t(usecs) % USECS_PER_DAY)};
+    }
+}
@@ -9,108 +9,83 @@
 
 #include <algorithm>
 #include "Ytime/LeapSeconds.hpp"
-#include "InternalDateTimeMath.hpp"
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+#include "InternalInstrumentation.hpp"
 #include "YtimeThrow.hpp"
 
+#ifndef YTIME_HEADER_ONLY
+    #include "Ytime/Detail/PackedDateTimeImpl.hpp"
+#endif
+
 namespace Ytime
 {
     namespace
     {
-        std::pair<uint64_t, uint64_t>
-        unpackDaysUsecondsUtc(PackedDateTime dateTime) noexcept
+        /* Returns the instant usecs after the start of day. */
+        int64_t packDayUsecs(const Detail::LeapSecondData& table,
+                             int64_t day, int64_t usecs) noexcept
         {
-            auto leapsecs = getLeapSeconds(dateTime);
-            auto secs = PackedDateTime(dateTime - leapsecs * USECS_PER_SEC);
-            auto dayUsecs = unpackDaysUseconds(secs);
-            if (isLeapSecond(dateTime))
-            {
-                --dayUsecs.first;
-                dayUsecs.second += USECS_PER_DAY;
-            }
-            return dayUsecs;
+            return day * int64_t(USECS_PER_DAY) + usecs
+                   + int64_t(Detail::getLeapSecondsForDay(table, uint32_t(day)))
+                     * int64_t(USECS_PER_SEC);
         }
     }
 
-    PackedDateTime pack(const DateTime& dateTime) noexcept
-    {
-        auto days = daysSinceEpochYMD(dateTime.date);
-        auto usecs = usecsSinceMidnight(dateTime.time);
-        return PackedDateTime(packDaysUseconds(days, usecs)
-                              + getLeapSeconds(dateTime.date) * USECS_PER_SEC);
-    }
-
-    DateTime unpack(PackedDateTime dateTime) noexcept
+    int getWeekday(PackedDateTime dateTime) noexcept
     {
-        auto daysUsecs = unpackDaysUsecondsUtc(dateTime);
-        return {toYMD(daysUsecs.first), toHMS(daysUsecs.second)};
-    }
-
-    Date unpackDate(PackedDateTime dateTime) noexcept
-    {
-        return toYMD(unpackDaysUsecondsUtc(dateTime).first);
-    }
-
-    Time unpackTime(PackedDateTime dateTime) noexcept
-    {
-        return toHMS(unpackDaysUsecondsUtc(dateTime).second);
+        auto day = Detail::unpackDaysUsecondsUtc(dateTime).first;
+        return int(Detail::getWeekdayIndex(day)) + 1;
     }
 
     DateTimeDelta getDateTimeDelta(PackedDateTime from, PackedDateTime to)
     {
+        YTIME_COUNT(calls);
         if (from == to)
             return {};
-        if (isLeapSecond(from))
+        auto& table = Detail::getLeapSecondData();
+        if (Detail::isLeapSecond(table, from))
             YTIME_THROW("Can not count days from a leap second.");
-        auto delta = int64_t(to - from);
-        auto toLS = int64_t(getLeapSeconds(to));
-        auto fromLS = int64_t(getLeapSeconds(from));
-        auto deltaLS = toLS - fromLS;
-        delta -= deltaLS * int64_t(USECS_PER_SEC);
-        auto days = delta / int64_t(USECS_PER_DAY);
 
-        auto to0 = int64_t(from) + days * int64_t(USECS_PER_DAY);
-        auto to0LS = int64_t(getLeapSeconds(PackedDateTime(to0)));
-        to0 += (to0LS - fromLS) * int64_t(USECS_PER_SEC);
-        auto usecs = int64_t(to) - to0;
-        if (isLeapSecond(PackedDateTime(to0)))
+        /* The days are counted on the calendar, from the time of day of
+           from to the same time of day on the day of to, or the day
+           before or after if that overshoots to. The rest is counted
+           in elapsed microseconds, including any leap seconds. */
+        auto [fromDay, fromUsecs] = Detail::unpackDaysUsecondsUtc(table, from);
+        auto toDay = Detail::unpackDaysUsecondsUtc(table, to).first;
+        auto days = int64_t(toDay) - int64_t(fromDay);
+        auto usecs = int64_t(to) - packDayUsecs(table, int64_t(toDay), fromUsecs);
+        if (days > 0 && usecs < 0)
+        {
+            --days;
+            usecs = int64_t(to) - packDayUsecs(table, int64_t(toDay) - 1,
+                                             fromUsecs);
+        }
+        else if (days < 0 && usecs > 0)
         {
-            if (usecs != 0)
-            {
-                usecs -= USECS_PER_SEC;
-            }
-            else if (days > 0)
-            {
-                --days;
-                usecs = USECS_PER_DAY;
-            }
-            else
-            {
-                ++days;
-                usecs = -int64_t(USECS_PER_DAY);
-            }
+            ++days;
+            usecs = int64_t(to) - packDayUsecs(table, int64_t(toDay) + 1,
+                                             fromUsecs);
         }
         return {days, usecs};
     }
 
     PackedDateTime add(PackedDateTime from, DateTimeDelta delta)
     {
+        YTIME_COUNT(calls);
         if (delta.days() == 0)
             return PackedDateTime(from + delta.totalUseconds());
 
-        if (isLeapSecond(from))
+        YTIME_COUNT(slowPaths);
+
+        auto& table = Detail::getLeapSecondData();
+        if (Detail::isLeapSecond(table, from))
             YTIME_THROW("Can not count days from a leap second.");
-        auto to = from + delta.days() * int64_t(USECS_PER_DAY);
-        auto toLS = int64_t(getLeapSeconds(PackedDateTime(to)));
-        auto fromLS = int64_t(getLeapSeconds(from));
-        to += (toLS - fromLS) * int64_t(USECS_PER_SEC);
-        if (isLeapSecond(PackedDateTime(to)))
-        {
-            if (delta.days() > 0)
-                to += USECS_PER_SEC;
-            else
-                to -= USECS_PER_SEC;
-        }
-        to += delta.totalUseconds();
-        return PackedDateTime(to);
+        auto [day, usecs] = Detail::unpackDaysUsecondsUtc(table, from);
+        auto toDay = int64_t(day) + delta.days();
+        auto to = packDayUsecs(table, toDay, usecs);
+        if (Detail::getLeapSecondsForDay(table, uint32_t(toDay))
+            != Detail::getLeapSecondsForDay(table, uint32_t(day)))
+            YTIME_COUNT(leapSecondHits);
+        return PackedDateTime(to + delta.totalUseconds());
     }
 }
@@ -0,0 +1,544 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/Recurrence.hpp"
+
+#include "Ytime/LeapSeconds.hpp"
+#include "Ytime/Detail/LeapSecondTable.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        /* The number of days in 400 years. */
+        constexpr int64_t SEARCH_LIMIT_DAYS = 146097;
+        constexpr int64_t DAY_USECS = USECS_PER_DAY;
+
+        constexpr int64_t ceilDiv(int64_t a, int64_t b) noexcept
+        {
+            return -Detail::floorDiv(-a, b);
+        }
+
+        int countTrailingZeros(uint64_t bits) noexcept
+        {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(bits);
+        #else
+            int n = 0;
+            while ((bits & 1u) == 0)
+            {
+                bits >>= 1u;
+                ++n;
+            }
+            return n;
+        #endif
+        }
+
+        template <typename T>
+        T makeMask(std::initializer_list<int> values, int min, int max,
+                   const char* name)
+        {
+            T mask = 0;
+            for (auto value : values)
+            {
+                if (value < min || max < value)
+                    YTIME_THROW(std::string("Invalid ") + name + ": "
+                                + std::to_string(value));
+                mask |= T(T(1) << unsigned(value));
+            }
+            return mask;
+        }
+
+        int64_t getUnitUsecs(Frequency frequency) noexcept
+        {
+            switch (frequency)
+            {
+            case Frequency::SECONDLY:
+                return int64_t(USECS_PER_SEC);
+            case Frequency::MINUTELY:
+                return int64_t(USECS_PER_MIN);
+            default:
+                return int64_t(USECS_PER_HOUR);
+            }
+        }
+
+        int64_t getMonthIndex(const Date& date) noexcept
+        {
+            return int64_t(date.year) * 12 + date.month - 1;
+        }
+
+        PackedDateTime packUsecs(int64_t usecs) noexcept
+        {
+            auto day = uint32_t(usecs / DAY_USECS);
+            auto packed = Detail::packDaysUseconds(day,
+                                                   uint64_t(usecs % DAY_USECS));
+            return PackedDateTime(packed
+                                  + Detail::getLeapSecondsForDay(day)
+                                    * USECS_PER_SEC);
+        }
+
+        /* Returns the time without leap seconds that no occurrence before
+           dateTime can be at or after. */
+        int64_t unpackUsecs(PackedDateTime dateTime) noexcept
+        {
+            auto& table = Detail::getLeapSecondData();
+            auto [days, usecs] = Detail::unpackDaysUsecondsUtc(table, dateTime);
+            auto result = int64_t(days * USECS_PER_DAY + usecs);
+            if (Detail::isLeapSecond(table, dateTime))
+                return result - result % DAY_USECS;
+            return result;
+        }
+    }
+
+    RecurrenceIterator& RecurrenceIterator::operator++()
+    {
+        if (m_Rule && !m_Rule->advance(*this, m_Usecs + 1))
+        {
+            m_Rule = nullptr;
+            m_Owner.reset();
+        }
+        return *this;
+    }
+
+    RecurrenceIterator RecurrenceIterator::operator++(int)
+    {
+        auto result = *this;
+        ++*this;
+        return result;
+    }
+
+    RecurrenceRule::RecurrenceRule(PackedDateTime start, Frequency frequency,
+                                   uint32_t interval)
+        : m_Start(start),
+          m_Frequency(frequency),
+          m_Interval(interval)
+    {
+        if (isLeapSecond(start))
+            YTIME_THROW("A recurrence can not start on a leap second.");
+        if (interval == 0)
+            YTIME_THROW("The recurrence interval must be at least 1.");
+        m_StartUsecs = unpackUsecs(start);
+        m_StartDay = uint32_t(m_StartUsecs / DAY_USECS);
+        updateDayFilter();
+    }
+
+    PackedDateTime RecurrenceRule::start() const noexcept
+    {
+        return m_Start;
+    }
+
+    Frequency RecurrenceRule::frequency() const noexcept
+    {
+        return m_Frequency;
+    }
+
+    uint32_t RecurrenceRule::interval() const noexcept
+    {
+        return m_Interval;
+    }
+
+    RecurrenceRule& RecurrenceRule::setCount(uint64_t count)
+    {
+        m_Count = count;
+        return *this;
+    }
+
+    RecurrenceRule& RecurrenceRule::setUntil(PackedDateTime until)
+    {
+        m_UntilUsecs = unpackUsecs(until);
+        return *this;
+    }
+
+    RecurrenceRule&
+    RecurrenceRule::setMonths(std::initializer_list<int> months)
+    {
+        m_Months = makeMask<uint16_t>(months, 1, 12, "month");
+        updateDayFilter();
+        return *this;
+    }
+
+    RecurrenceRule&
+    RecurrenceRule::setMonthDays(std::initializer_list<int> days)
+    {
+        m_MonthDays = 0;
+        m_NegativeMonthDays = 0;
+        for (auto day : days)
+        {
+            if (day == 0 || day < -31 || 31 < day)
+                YTIME_THROW("Invalid day of month: " + std::to_string(day));
+            if (day > 0)
+                m_MonthDays |= 1u << unsigned(day);
+            else
+                m_NegativeMonthDays |= 1u << unsigned(-day);
+        }
+        updateDayFilter();
+        return *this;
+    }
+
+    RecurrenceRule&
+    RecurrenceRule::setWeekdays(std::initializer_list<int> weekdays)
+    {
+        m_Weekdays = uint8_t(makeMask<uint16_t>(weekdays, 1, 7, "weekday") >> 1u);
+        m_NthWeekdays.clear();
+        updateDayFilter();
+        return *this;
+    }
+
+    RecurrenceRule& RecurrenceRule::addWeekday(int weekday, int n)
+    {
+        if (weekday < 1 || 7 < weekday)
+            YTIME_THROW("Invalid weekday: " + std::to_string(weekday));
+        if (n == 0)
+        {
+            m_Weekdays |= uint8_t(1u << unsigned(weekday - 1));
+        }
+        else
+        {
+            if (m_Frequency != Frequency::MONTHLY
+                && m_Frequency != Frequency::YEARLY)
+            {
+                YTIME_THROW("Numbered weekdays require a MONTHLY or YEARLY frequency.");
+            }
+            if (n < -53 || 53 < n)
+                YTIME_THROW("Invalid weekday number: " + std::to_string(n));
+            m_NthWeekdays.emplace_back(weekday, n);
+        }
+        updateDayFilter();
+        return *this;
+    }
+
+    RecurrenceRule& RecurrenceRule::setHours(std::initializer_list<int> hours)
+    {
+        m_Hours = makeMask<uint32_t>(hours, 0, 23, "hour");
+        return *this;
+    }
+
+    RecurrenceRule&
+    RecurrenceRule::setMinutes(std::initializer_list<int> minutes)
+    {
+        m_Minutes = makeMask<uint64_t>(minutes, 0, 59, "minute");
+        return *this;
+    }
+
+    RecurrenceRule&
+    RecurrenceRule::setPositions(std::initializer_list<int> positions)
+    {
+        if (m_Frequency < Frequency::DAILY)
+            YTIME_THROW("Positions require a frequency of DAILY or more.");
+        for (auto pos : positions)
+        {
+            if (pos == 0 || pos < -366 || 366 < pos)
+                YTIME_THROW("Invalid position: " + std::to_string(pos));
+        }
+        m_Positions.assign(positions.begin(), positions.end());
+        return *this;
+    }
+
+    RecurrenceRange RecurrenceRule::occurrences() const
+    {
+        auto rule = std::make_shared<const RecurrenceRule>(*this);
+        auto it = rule->makeIterator(m_StartUsecs);
+        it.m_Owner = std::move(rule);
+        return {std::move(it)};
+    }
+
+    RecurrenceRange RecurrenceRule::occurrencesFrom(PackedDateTime from) const
+    {
+        auto rule = std::make_shared<const RecurrenceRule>(*this);
+        auto it = rule->makeIteratorFrom(from);
+        it.m_Owner = std::move(rule);
+        return {std::move(it)};
+    }
+
+    std::optional<PackedDateTime> RecurrenceRule::next(PackedDateTime from) const
+    {
+        auto it = makeIteratorFrom(from);
+        if (it == RecurrenceIterator())
+            return {};
+        return *it;
+    }
+
+    RecurrenceIterator RecurrenceRule::makeIterator(int64_t minUsecs) const
+    {
+        RecurrenceIterator it;
+        it.m_Rule = this;
+        if (!advance(it, minUsecs))
+            it.m_Rule = nullptr;
+        return it;
+    }
+
+    RecurrenceIterator
+    RecurrenceRule::makeIteratorFrom(PackedDateTime from) const
+    {
+        /* With a count, the occurrences before from must be counted. */
+        if (m_Count != 0)
+        {
+            auto it = makeIterator(m_StartUsecs);
+            while (it != RecurrenceIterator() && *it < from)
+                ++it;
+            return it;
+        }
+
+        return makeIterator(std::max(m_StartUsecs, unpackUsecs(from)));
+    }
+
+    bool RecurrenceRule::advance(RecurrenceIterator& it, int64_t minUsecs) const
+    {
+        if (m_Count != 0 && it.m_Index >= m_Count)
+            return false;
+
+        auto found = m_Frequency < Frequency::DAILY
+                     ? advanceSubDaily(it, minUsecs)
+                     : advanceDaily(it, minUsecs);
+        if (!found || it.m_Usecs > m_UntilUsecs)
+            return false;
+
+        it.m_Value = packUsecs(it.m_Usecs);
+        ++it.m_Index;
+        return true;
+    }
+
+    bool RecurrenceRule::advanceSubDaily(RecurrenceIterator& it,
+                                         int64_t minUsecs) const
+    {
+        auto step = getUnitUsecs(m_Frequency) * m_Interval;
+        auto k = std::max<int64_t>(ceilDiv(minUsecs - m_StartUsecs, step), 0);
+        auto limit = minUsecs + SEARCH_LIMIT_DAYS * DAY_USECS;
+        while (true)
+        {
+            auto usecs = m_StartUsecs + k * step;
+            if (usecs > limit || usecs > m_UntilUsecs)
+                return false;
+
+            /* If usecs doesn't match, find the start of the next day, hour
+               or minute that might, and continue from the first step at
+               or after it. */
+            auto dayStart = usecs - usecs % DAY_USECS;
+            auto hour = unsigned((usecs - dayStart) / USECS_PER_HOUR);
+            auto hourStart = dayStart + hour * USECS_PER_HOUR;
+            auto minute = unsigned((usecs - hourStart) / USECS_PER_MIN);
+            int64_t next;
+            if (!isMatchingDay(uint32_t(dayStart / DAY_USECS)))
+            {
+                next = dayStart + DAY_USECS;
+            }
+            else if (m_Hours != 0 && ((m_Hours >> hour) & 1u) == 0)
+            {
+                auto later = m_Hours & ~((2u << hour) - 1);
+                next = later != 0
+                       ? dayStart + countTrailingZeros(later) * USECS_PER_HOUR
+                       : dayStart + DAY_USECS;
+            }
+            else if (m_Minutes != 0 && ((m_Minutes >> minute) & 1u) == 0)
+            {
+                auto later = m_Minutes & ~((uint64_t(2) << minute) - 1);
+                next = later != 0
+                       ? hourStart + countTrailingZeros(later) * USECS_PER_MIN
+                       : hourStart + USECS_PER_HOUR;
+            }
+            else
+            {
+                it.m_Usecs = usecs;
+                return true;
+            }
+            k = ceilDiv(next - m_StartUsecs, step);
+        }
+    }
+
+    bool RecurrenceRule::advanceDaily(RecurrenceIterator& it,
+                                      int64_t minUsecs) const
+    {
+        auto timeOfDay = m_StartUsecs % DAY_USECS;
+        auto minDay = uint32_t(ceilDiv(minUsecs - timeOfDay, DAY_USECS));
+        auto limitDay = minDay + SEARCH_LIMIT_DAYS;
+        for (auto period = std::max<int64_t>(getPeriod(minDay), 0);;
+             ++period)
+        {
+            if (it.m_Period != period)
+            {
+                if (getPeriodDays(period).first > limitDay)
+                    return false;
+                makeCandidates(period, it.m_Days);
+                it.m_Period = period;
+            }
+
+            auto day = std::lower_bound(it.m_Days.begin(), it.m_Days.end(),
+                                        minDay);
+            if (day != it.m_Days.end())
+            {
+                it.m_Usecs = int64_t(*day) * DAY_USECS + timeOfDay;
+                return true;
+            }
+        }
+    }
+
+    int64_t RecurrenceRule::getPeriod(uint32_t day) const noexcept
+    {
+        int64_t units;
+        switch (m_Frequency)
+        {
+        case Frequency::WEEKLY:
+            units = (int64_t(day - Detail::getWeekdayIndex(day))
+                     - int64_t(m_StartDay
+                               - Detail::getWeekdayIndex(m_StartDay))) / 7;
+            break;
+        case Frequency::MONTHLY:
+            units = getMonthIndex(Detail::toYMD(day))
+                    - getMonthIndex(Detail::toYMD(m_StartDay));
+            break;
+        case Frequency::YEARLY:
+            units = int64_t(Detail::toYMD(day).year)
+                    - Detail::toYMD(m_StartDay).year;
+            break;
+        default:
+            units = int64_t(day) - m_StartDay;
+            break;
+        }
+        return Detail::floorDiv(units, m_Interval);
+    }
+
+    std::pair<uint32_t, uint32_t>
+    RecurrenceRule::getPeriodDays(int64_t period) const
+    {
+        auto units = period * m_Interval;
+        switch (m_Frequency)
+        {
+        case Frequency::WEEKLY:
+        {
+            auto first = uint32_t(m_StartDay
+                                  - Detail::getWeekdayIndex(m_StartDay)
+                                  + units * 7);
+            return {first, first + 7};
+        }
+        case Frequency::MONTHLY:
+        {
+            auto month = getMonthIndex(Detail::toYMD(m_StartDay)) + units;
+            auto year = int(month / 12);
+            auto monthOfYear = int(month % 12) + 1;
+            auto first = Detail::daysSinceEpochYMD({year, monthOfYear, 1});
+            return {first, first + getDaysInMonth(year, monthOfYear)};
+        }
+        case Frequency::YEARLY:
+        {
+            auto year = int(Detail::toYMD(m_StartDay).year + units);
+            return {Detail::daysSinceEpochYMD({year, 1, 1}),
+                    Detail::daysSinceEpochYMD({year + 1, 1, 1})};
+        }
+        default:
+        {
+            auto first = uint32_t(m_StartDay + units);
+            return {first, first + 1};
+        }
+        }
+    }
+
+    void RecurrenceRule::makeCandidates(int64_t period,
+                                        std::vector<uint32_t>& days) const
+    {
+        days.clear();
+        auto [first, end] = getPeriodDays(period);
+        for (auto day = first; day != end; ++day)
+        {
+            if (isMatchingDay(day))
+                days.push_back(day);
+        }
+
+        if (m_Positions.empty() || days.empty())
+            return;
+
+        auto all = days;
+        days.clear();
+        auto size = int(all.size());
+        for (auto pos : m_Positions)
+        {
+            auto i = pos > 0 ? pos - 1 : size + pos;
+            if (0 <= i && i < size)
+                days.push_back(all[i]);
+        }
+        std::sort(days.begin(), days.end());
+        days.erase(std::unique(days.begin(), days.end()), days.end());
+    }
+
+    bool RecurrenceRule::isMatchingDay(uint32_t day) const noexcept
+    {
+        auto date = Detail::toYMD(day);
+        if (m_DayMonths != 0 && ((m_DayMonths >> unsigned(date.month)) & 1u) == 0)
+            return false;
+
+        auto daysInMonth = getDaysInMonth(date.year, date.month);
+        if (m_DayMonthDays != 0 || m_NegativeMonthDays != 0)
+        {
+            auto fromEnd = unsigned(daysInMonth - date.day + 1);
+            if (((m_DayMonthDays >> unsigned(date.day)) & 1u) == 0
+                && ((m_NegativeMonthDays >> fromEnd) & 1u) == 0)
+            {
+                return false;
+            }
+        }
+
+        if (m_DayWeekdays == 0 && m_NthWeekdays.empty())
+            return true;
+
+        auto weekday = Detail::getWeekdayIndex(day);
+        if ((m_DayWeekdays >> weekday) & 1u)
+            return true;
+
+        for (auto [nthWeekday, n] : m_NthWeekdays)
+        {
+            if (unsigned(nthWeekday - 1) != weekday)
+                continue;
+            int pos = date.day;
+            int size = daysInMonth;
+            if (m_Frequency == Frequency::YEARLY && m_Months == 0)
+            {
+                auto firstDay = Detail::daysSinceEpochYMD({date.year, 1, 1});
+                pos = int(day - firstDay) + 1;
+                size = isLeapYear(date.year) ? 366 : 365;
+            }
+            if (n > 0 ? (pos - 1) / 7 + 1 == n : (size - pos) / 7 + 1 == -n)
+                return true;
+        }
+        return false;
+    }
+
+    void RecurrenceRule::updateDayFilter() noexcept
+    {
+        m_DayMonths = m_Months;
+        m_DayMonthDays = m_MonthDays;
+        m_DayWeekdays = m_Weekdays;
+
+        auto hasWeekdays = m_Weekdays != 0 || !m_NthWeekdays.empty();
+        auto hasDays = hasWeekdays || m_MonthDays != 0
+                       || m_NegativeMonthDays != 0;
+        auto start = Detail::toYMD(m_StartDay);
+        switch (m_Frequency)
+        {
+        case Frequency::WEEKLY:
+            if (!hasWeekdays)
+            {
+                auto weekday = Detail::getWeekdayIndex(m_StartDay);
+                m_DayWeekdays = uint8_t(1u << weekday);
+            }
+            break;
+        case Frequency::MONTHLY:
+            if (!hasDays)
+                m_DayMonthDays = 1u << unsigned(start.day);
+            break;
+        case Frequency::YEARLY:
+            if (!hasDays)
+            {
+                m_DayMonthDays = 1u << unsigned(start.day);
+                if (m_Months == 0)
+                    m_DayMonths = uint16_t(1u << unsigned(start.month));
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
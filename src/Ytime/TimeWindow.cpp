@@ -0,0 +1,276 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimeWindow.hpp"
+
+#include "Ytime/Detail/LeapSecondTable.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        /* The writer side of a sequence lock. The sequence is odd while
+           the values are being written. */
+        template <typename WriteFunc>
+        void writeLocked(std::atomic<uint64_t>& sequence, WriteFunc write)
+        {
+            auto seq = sequence.load(std::memory_order_relaxed);
+            sequence.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            write();
+            sequence.store(seq + 2, std::memory_order_release);
+        }
+
+        /* The reader side of a sequence lock. read is repeated until it
+           has run without a concurrent write. */
+        template <typename ReadFunc>
+        void readLocked(const std::atomic<uint64_t>& sequence, ReadFunc read)
+        {
+            while (true)
+            {
+                auto seq = sequence.load(std::memory_order_acquire);
+                if (seq & 1u)
+                    continue;
+                read();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence.load(std::memory_order_relaxed) == seq)
+                    return;
+            }
+        }
+    }
+
+    SlidingWindow::SlidingWindow(DateTimeDelta width, size_t capacity)
+        : m_Width(width.days() * int64_t(USECS_PER_DAY)
+                  + width.totalUseconds()),
+          m_Events(capacity)
+    {
+        if (m_Width <= 0)
+            YTIME_THROW("The window width must be positive.");
+        if (capacity == 0)
+            YTIME_THROW("The window capacity must be at least 1.");
+    }
+
+    bool SlidingWindow::insert(PackedDateTime time, double value)
+    {
+        if (time < m_Latest)
+            return false;
+        m_Latest = time;
+        evict(time);
+        if (m_Size == m_Events.size())
+        {
+            publish();
+            return false;
+        }
+
+        m_Events[(m_Head + m_Size) % m_Events.size()] = {time, value};
+        ++m_Size;
+        m_Sum += value;
+        publish();
+        return true;
+    }
+
+    void SlidingWindow::advance(PackedDateTime now)
+    {
+        if (now < m_Latest)
+            return;
+        m_Latest = now;
+        evict(now);
+        publish();
+    }
+
+    WindowAggregate SlidingWindow::aggregate() const noexcept
+    {
+        WindowAggregate result;
+        readLocked(m_Sequence, [&]
+        {
+            result.count = m_PublishedCount.load(std::memory_order_relaxed);
+            result.sum = m_PublishedSum.load(std::memory_order_relaxed);
+        });
+        return result;
+    }
+
+    PackedDateTime SlidingWindow::latest() const noexcept
+    {
+        return PackedDateTime(m_PublishedLatest.load(std::memory_order_acquire));
+    }
+
+    size_t SlidingWindow::capacity() const noexcept
+    {
+        return m_Events.size();
+    }
+
+    void SlidingWindow::evict(PackedDateTime now) noexcept
+    {
+        while (m_Size != 0
+               && int64_t(now - m_Events[m_Head].time) >= m_Width)
+        {
+            m_Sum -= m_Events[m_Head].value;
+            m_Head = (m_Head + 1) % m_Events.size();
+            --m_Size;
+        }
+        if (m_Size == 0)
+            m_Sum = 0;
+    }
+
+    void SlidingWindow::publish() noexcept
+    {
+        writeLocked(m_Sequence, [&]
+        {
+            m_PublishedCount.store(m_Size, std::memory_order_relaxed);
+            m_PublishedSum.store(m_Sum, std::memory_order_relaxed);
+            m_PublishedLatest.store(m_Latest, std::memory_order_relaxed);
+        });
+    }
+
+    TumblingWindow::TumblingWindow(CalendarUnit unit, size_t bucketCount)
+        : m_Unit(unit),
+          m_Size(bucketCount),
+          m_Slots(std::make_unique<Slot[]>(bucketCount))
+    {
+        if (bucketCount == 0)
+            YTIME_THROW("The bucket count must be at least 1.");
+    }
+
+    bool TumblingWindow::insert(PackedDateTime time, double value)
+    {
+        auto newest = m_NewestKey.load(std::memory_order_relaxed);
+        int64_t key;
+        if (newest != INT64_MIN && m_CurrentStart <= time && time < m_CurrentEnd)
+        {
+            key = newest;
+        }
+        else
+        {
+            key = getKey(time);
+            if (newest == INT64_MIN || key > newest)
+            {
+                /* Skipped buckets are left as they are, their slots'
+                   keys don't match and they are therefore read as
+                   empty. */
+                m_NewestKey.store(key, std::memory_order_release);
+                m_CurrentStart = getStart(key);
+                m_CurrentEnd = getStart(key + 1);
+            }
+            else if (key <= newest - int64_t(m_Size))
+            {
+                return false;
+            }
+        }
+
+        auto& slot = m_Slots[uint64_t(key) % m_Size];
+        uint64_t count = 0;
+        double sum = 0;
+        if (slot.key.load(std::memory_order_relaxed) == key)
+        {
+            count = slot.count.load(std::memory_order_relaxed);
+            sum = slot.sum.load(std::memory_order_relaxed);
+        }
+        writeSlot(key, count + 1, sum + value);
+        return true;
+    }
+
+    std::optional<WindowBucket> TumblingWindow::bucket(PackedDateTime time) const
+    {
+        return readSlot(getKey(time));
+    }
+
+    std::optional<WindowBucket> TumblingWindow::current() const
+    {
+        auto newest = m_NewestKey.load(std::memory_order_acquire);
+        if (newest == INT64_MIN)
+            return {};
+        return readSlot(newest);
+    }
+
+    int64_t TumblingWindow::getKey(PackedDateTime time) const noexcept
+    {
+        auto [days, usecs] = Detail::unpackDaysUsecondsUtc(time);
+        /* Puts leap seconds in the last minute of their day. */
+        usecs = std::min(usecs, USECS_PER_DAY - 1);
+        switch (m_Unit)
+        {
+        case CalendarUnit::MINUTE:
+            return int64_t(days * 1440 + usecs / USECS_PER_MIN);
+        case CalendarUnit::HOUR:
+            return int64_t(days * 24 + usecs / USECS_PER_HOUR);
+        case CalendarUnit::DAY:
+            return int64_t(days);
+        case CalendarUnit::MONTH:
+        {
+            auto date = Detail::toYMD(days);
+            return int64_t(date.year) * 12 + date.month - 1;
+        }
+        default:
+            return Detail::toYMD(days).year;
+        }
+    }
+
+    PackedDateTime TumblingWindow::getStart(int64_t key) const noexcept
+    {
+        uint64_t days = 0, usecs = 0;
+        switch (m_Unit)
+        {
+        case CalendarUnit::MINUTE:
+            days = uint64_t(key / 1440);
+            usecs = uint64_t(key % 1440) * USECS_PER_MIN;
+            break;
+        case CalendarUnit::HOUR:
+            days = uint64_t(key / 24);
+            usecs = uint64_t(key % 24) * USECS_PER_HOUR;
+            break;
+        case CalendarUnit::DAY:
+            days = uint64_t(key);
+            break;
+        case CalendarUnit::MONTH:
+            days = Detail::daysSinceEpochYMD({int(key / 12),
+                                              int(key % 12) + 1, 1});
+            break;
+        default:
+            days = Detail::daysSinceEpochYMD({int(key), 1, 1});
+            break;
+        }
+        auto leapSecs = Detail::getLeapSecondsForDay(uint32_t(days));
+        return PackedDateTime(Detail::packDaysUseconds(days, usecs)
+                              + leapSecs * USECS_PER_SEC);
+    }
+
+    std::optional<WindowBucket> TumblingWindow::readSlot(int64_t key) const
+    {
+        auto newest = m_NewestKey.load(std::memory_order_acquire);
+        if (newest == INT64_MIN || key > newest
+            || key <= newest - int64_t(m_Size))
+        {
+            return {};
+        }
+
+        auto& slot = m_Slots[uint64_t(key) % m_Size];
+        WindowBucket result = {getStart(key), getStart(key + 1), {}};
+        readLocked(slot.sequence, [&]
+        {
+            result.aggregate = {};
+            if (slot.key.load(std::memory_order_relaxed) == key)
+            {
+                result.aggregate.count = slot.count.load(std::memory_order_relaxed);
+                result.aggregate.sum = slot.sum.load(std::memory_order_relaxed);
+            }
+        });
+        return result;
+    }
+
+    void TumblingWindow::writeSlot(int64_t key, uint64_t count,
+                                   double sum) noexcept
+    {
+        auto& slot = m_Slots[uint64_t(key) % m_Size];
+        writeLocked(slot.sequence, [&]
+        {
+            slot.key.store(key, std::memory_order_relaxed);
+            slot.count.store(count, std::memory_order_relaxed);
+            slot.sum.store(sum, std::memory_order_relaxed);
+        });
+    }
+}
@@ -0,0 +1,688 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimeZone.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include "Ytime/LeapSeconds.hpp"
+#include "Ytime/UnixTime.hpp"
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr int64_t USECS = USECS_PER_SEC;
+        constexpr int RULE_LAST_YEAR = 2200;
+        constexpr int64_t MIN_UNIX_SECS =
+            (int64_t(Detail::daysSinceEpochYMD({int(MIN_YEAR), 1, 1}))
+             - int64_t(Detail::UNIX_EPOCH_DAYS)) * SECS_PER_DAY;
+
+        DateTime shiftDateTime(const DateTime& dt, int32_t offsetSecs) noexcept
+        {
+            auto leap = dt.time.second == 60 ? 1 : 0;
+            auto secs = int64_t(dt.time.hour) * 3600 + dt.time.minute * 60
+                        + dt.time.second - leap + offsetSecs;
+            auto days = Detail::floorDiv(secs, SECS_PER_DAY);
+            secs -= days * SECS_PER_DAY;
+            days += Detail::daysSinceEpochYMD(dt.date);
+            return {Detail::toYMD(uint64_t(days)),
+                    Time(int(secs / 3600), int(secs / 60 % 60),
+                         int(secs % 60) + leap, dt.time.usecond)};
+        }
+
+        int64_t toLocalUnixUsecs(const DateTime& local) noexcept
+        {
+            auto days = int64_t(Detail::daysSinceEpochYMD(local.date))
+                        - int64_t(Detail::UNIX_EPOCH_DAYS);
+            return days * int64_t(USECS_PER_DAY)
+                   + int64_t(Detail::usecsSinceMidnight(local.time));
+        }
+
+        class TzifReader
+        {
+        public:
+            TzifReader(const char* data, size_t size)
+                : m_Data(data), m_Size(size)
+            {}
+
+            uint8_t readUInt8()
+            {
+                require(1);
+                return uint8_t(m_Data[m_Pos++]);
+            }
+
+            int64_t readInt(size_t size)
+            {
+                require(size);
+                uint64_t value = 0;
+                for (size_t i = 0; i < size; ++i)
+                    value = (value << 8u) | uint8_t(m_Data[m_Pos++]);
+                if (size == 4)
+                    return int32_t(uint32_t(value));
+                return int64_t(value);
+            }
+
+            std::string_view readString(size_t size)
+            {
+                require(size);
+                std::string_view result(m_Data + m_Pos, size);
+                m_Pos += size;
+                return result;
+            }
+
+            std::string_view readLine()
+            {
+                auto start = m_Pos;
+                while (m_Pos != m_Size && m_Data[m_Pos] != '\n')
+                    ++m_Pos;
+                if (m_Pos == m_Size)
+                    YTIME_THROW("The TZif footer doesn't end with a newline.");
+                return {m_Data + start, m_Pos++ - start};
+            }
+
+            void skip(size_t size)
+            {
+                require(size);
+                m_Pos += size;
+            }
+        private:
+            void require(size_t size) const
+            {
+                if (m_Size - m_Pos < size)
+                    YTIME_THROW("Truncated TZif data.");
+            }
+
+            const char* m_Data;
+            size_t m_Size;
+            size_t m_Pos = 0;
+        };
+
+        struct TzifHeader
+        {
+            char version = 0;
+            uint32_t isUtcCount = 0;
+            uint32_t isStdCount = 0;
+            uint32_t leapCount = 0;
+            uint32_t timeCount = 0;
+            uint32_t typeCount = 0;
+            uint32_t charCount = 0;
+        };
+
+        TzifHeader readTzifHeader(TzifReader& reader)
+        {
+            if (reader.readString(4) != "TZif")
+                YTIME_THROW("Data is not in TZif format.");
+            TzifHeader header;
+            header.version = char(reader.readUInt8());
+            reader.skip(15);
+            header.isUtcCount = uint32_t(reader.readInt(4));
+            header.isStdCount = uint32_t(reader.readInt(4));
+            header.leapCount = uint32_t(reader.readInt(4));
+            header.timeCount = uint32_t(reader.readInt(4));
+            header.typeCount = uint32_t(reader.readInt(4));
+            header.charCount = uint32_t(reader.readInt(4));
+            if (header.typeCount == 0)
+                YTIME_THROW("TZif data has no local time types.");
+            return header;
+        }
+
+        void skipTzifBlock(TzifReader& reader, const TzifHeader& header,
+                           size_t timeSize)
+        {
+            reader.skip(header.timeCount * (timeSize + 1)
+                        + header.typeCount * 6
+                        + header.charCount
+                        + header.leapCount * (timeSize + 4)
+                        + header.isStdCount
+                        + header.isUtcCount);
+        }
+
+        struct Transitions
+        {
+            std::vector<int64_t> times;
+            std::vector<int32_t> offsets;
+        };
+
+        Transitions readTzifBlock(TzifReader& reader, const TzifHeader& header,
+                                  size_t timeSize)
+        {
+            std::vector<int64_t> times(header.timeCount);
+            for (auto& time : times)
+                time = reader.readInt(timeSize);
+
+            std::vector<uint8_t> indexes(header.timeCount);
+            for (auto& index : indexes)
+            {
+                index = reader.readUInt8();
+                if (index >= header.typeCount)
+                    YTIME_THROW("TZif data has an invalid local time type index.");
+            }
+
+            std::vector<int32_t> typeOffsets(header.typeCount);
+            for (auto& offset : typeOffsets)
+            {
+                offset = int32_t(reader.readInt(4));
+                reader.skip(2);
+            }
+
+            reader.skip(header.charCount
+                        + header.leapCount * (timeSize + 4)
+                        + header.isStdCount
+                        + header.isUtcCount);
+
+            Transitions result;
+            result.offsets.push_back(typeOffsets[0]);
+            for (size_t i = 0; i < times.size(); ++i)
+            {
+                if (times[i] < MIN_UNIX_SECS)
+                {
+                    result.offsets.back() = typeOffsets[indexes[i]];
+                    continue;
+                }
+                result.times.push_back(times[i]);
+                result.offsets.push_back(typeOffsets[indexes[i]]);
+            }
+            return result;
+        }
+
+        struct PosixRule
+        {
+            enum Kind {JULIAN, ZERO_BASED, MONTH_WEEK_DAY};
+            Kind kind = MONTH_WEEK_DAY;
+            int day = 0;
+            int month = 0;
+            int week = 0;
+            int weekday = 0;
+            int32_t time = 7200;
+        };
+
+        struct PosixTimeZone
+        {
+            int32_t stdOffset = 0;
+            bool hasDst = false;
+            int32_t dstOffset = 0;
+            PosixRule dstStart;
+            PosixRule dstEnd;
+        };
+
+        /* Parses TZ strings as described in POSIX and extended in RFC 8536,
+           e.g. "CET-1CEST,M3.5.0,M10.5.0/3" and "<+03>-3". */
+        class PosixTzParser
+        {
+        public:
+            explicit PosixTzParser(std::string_view str)
+                : m_Str(str)
+            {}
+
+            PosixTimeZone parse()
+            {
+                PosixTimeZone result;
+                readName();
+                result.stdOffset = -readTime(24);
+                if (atEnd())
+                    return result;
+
+                result.hasDst = true;
+                readName();
+                if (!atEnd() && peek() != ',')
+                    result.dstOffset = -readTime(24);
+                else
+                    result.dstOffset = result.stdOffset + 3600;
+
+                if (atEnd())
+                {
+                    /* The default rule in POSIX is implementation
+                       defined, use the current US rule like glibc. */
+                    result.dstStart = {PosixRule::MONTH_WEEK_DAY, 0, 3, 2, 0};
+                    result.dstEnd = {PosixRule::MONTH_WEEK_DAY, 0, 11, 1, 0};
+                    return result;
+                }
+
+                expect(',');
+                result.dstStart = readRule();
+                expect(',');
+                result.dstEnd = readRule();
+                if (!atEnd())
+                    fail();
+                return result;
+            }
+        private:
+            bool atEnd() const
+            {
+                return m_Pos == m_Str.size();
+            }
+
+            char peek() const
+            {
+                return atEnd() ? '\0' : m_Str[m_Pos];
+            }
+
+            [[noreturn]] static void fail()
+            {
+                YTIME_THROW("Invalid POSIX TZ string in TZif data.");
+            }
+
+            void expect(char c)
+            {
+                if (peek() != c)
+                    fail();
+                ++m_Pos;
+            }
+
+            void readName()
+            {
+                auto start = m_Pos;
+                if (peek() == '<')
+                {
+                    while (!atEnd() && m_Str[m_Pos] != '>')
+                        ++m_Pos;
+                    expect('>');
+                }
+                else
+                {
+                    while (('A' <= peek() && peek() <= 'Z')
+                           || ('a' <= peek() && peek() <= 'z'))
+                    {
+                        ++m_Pos;
+                    }
+                }
+                if (m_Pos == start)
+                    fail();
+            }
+
+            int readNumber(int maxValue)
+            {
+                int value = 0;
+                auto start = m_Pos;
+                while ('0' <= peek() && peek() <= '9' && value <= maxValue)
+                    value = value * 10 + (m_Str[m_Pos++] - '0');
+                if (m_Pos == start || value > maxValue)
+                    fail();
+                return value;
+            }
+
+            int32_t readTime(int maxHours)
+            {
+                int sign = 1;
+                if (peek() == '+' || peek() == '-')
+                    sign = m_Str[m_Pos++] == '-' ? -1 : 1;
+                auto secs = readNumber(maxHours) * 3600;
+                if (peek() == ':')
+                {
+                    ++m_Pos;
+                    secs += readNumber(59) * 60;
+                    if (peek() == ':')
+                    {
+                        ++m_Pos;
+                        secs += readNumber(59);
+                    }
+                }
+                return sign * secs;
+            }
+
+            PosixRule readRule()
+            {
+                PosixRule rule;
+                if (peek() == 'J')
+                {
+                    ++m_Pos;
+                    rule.kind = PosixRule::JULIAN;
+                    rule.day = readNumber(365);
+                    if (rule.day == 0)
+                        fail();
+                }
+                else if (peek() == 'M')
+                {
+                    ++m_Pos;
+                    rule.kind = PosixRule::MONTH_WEEK_DAY;
+                    rule.month = readNumber(12);
+                    expect('.');
+                    rule.week = readNumber(5);
+                    expect('.');
+                    rule.weekday = readNumber(6);
+                    if (rule.month == 0 || rule.week == 0)
+                        fail();
+                }
+                else
+                {
+                    rule.kind = PosixRule::ZERO_BASED;
+                    rule.day = readNumber(365);
+                }
+
+                if (peek() == '/')
+                {
+                    ++m_Pos;
+                    rule.time = readTime(167);
+                }
+                return rule;
+            }
+
+            std::string_view m_Str;
+            size_t m_Pos = 0;
+        };
+
+        /* Returns the Unix time in seconds when rule takes effect
+           in local time. */
+        int64_t getLocalRuleTime(const PosixRule& rule, int year)
+        {
+            int64_t jan1 = Detail::daysSinceEpochYMD({year, 1, 1});
+            int64_t day = 0;
+            switch (rule.kind)
+            {
+            case PosixRule::JULIAN:
+                day = jan1 + rule.day - 1;
+                if (isLeapYear(year) && rule.day >= 60)
+                    ++day;
+                break;
+            case PosixRule::ZERO_BASED:
+                day = jan1 + rule.day;
+                break;
+            case PosixRule::MONTH_WEEK_DAY:
+            {
+                int64_t first = Detail::daysSinceEpochYMD({year, rule.month,
+                                                           1});
+                /* POSIX weekdays start with Sunday as 0. */
+                auto weekday = (Detail::getWeekdayIndex(first) + 1) % 7;
+                day = first + (rule.weekday - weekday + 7) % 7
+                      + (rule.week - 1) * 7;
+                auto end = first + getDaysInMonth(year, rule.month);
+                while (day >= end)
+                    day -= 7;
+                break;
+            }
+            }
+            return (day - Detail::UNIX_EPOCH_DAYS) * SECS_PER_DAY + rule.time;
+        }
+
+        void addRuleTransitions(Transitions& transitions,
+                                const PosixTimeZone& tz)
+        {
+            auto lastTime = transitions.times.empty()
+                            ? std::numeric_limits<int64_t>::min()
+                            : transitions.times.back();
+            if (!tz.hasDst)
+            {
+                if (transitions.times.empty())
+                    transitions.offsets.back() = tz.stdOffset;
+                return;
+            }
+
+            auto firstYear = 1970;
+            if (!transitions.times.empty())
+                firstYear = unpackDate(fromUnixTime(lastTime)).year;
+
+            for (auto year = firstYear; year <= RULE_LAST_YEAR; ++year)
+            {
+                std::pair<int64_t, int32_t> changes[2] = {
+                    {getLocalRuleTime(tz.dstStart, year) - tz.stdOffset,
+                     tz.dstOffset},
+                    {getLocalRuleTime(tz.dstEnd, year) - tz.dstOffset,
+                     tz.stdOffset}
+                };
+                if (changes[1].first < changes[0].first)
+                    std::swap(changes[0], changes[1]);
+                for (auto& [time, offset] : changes)
+                {
+                    if (time <= lastTime)
+                        continue;
+                    transitions.times.push_back(time);
+                    transitions.offsets.push_back(offset);
+                    lastTime = time;
+                }
+            }
+        }
+    }
+
+    TimeZone::TimeZone()
+        : TimeZone("UTC", {}, {0})
+    {}
+
+    TimeZone::TimeZone(std::string name,
+                       const std::vector<PackedDateTime>& transitions,
+                       std::vector<int32_t> offsets)
+        : m_Name(std::move(name))
+    {
+        if (offsets.size() != transitions.size() + 1)
+            YTIME_THROW("There must be one more offset than transitions.");
+
+        m_Starts.push_back(PackedDateTime(0));
+        m_Offsets.push_back(offsets[0]);
+        m_LocalStarts.push_back(std::numeric_limits<int64_t>::min());
+        for (size_t i = 0; i < transitions.size(); ++i)
+        {
+            if (offsets[i + 1] == m_Offsets.back())
+                continue;
+            if (transitions[i] <= m_Starts.back())
+                YTIME_THROW("The transitions are not sorted.");
+            m_Starts.push_back(transitions[i]);
+            m_Offsets.push_back(offsets[i + 1]);
+            m_LocalStarts.push_back(toUnixTimeUsecs(transitions[i])
+                                    + offsets[i + 1] * USECS);
+        }
+    }
+
+    TimeZone::TimeZone(const TimeZone& other)
+        : m_Name(other.m_Name),
+          m_Starts(other.m_Starts),
+          m_Offsets(other.m_Offsets),
+          m_LocalStarts(other.m_LocalStarts)
+    {}
+
+    TimeZone::TimeZone(TimeZone&& other) noexcept
+        : m_Name(std::move(other.m_Name)),
+          m_Starts(std::move(other.m_Starts)),
+          m_Offsets(std::move(other.m_Offsets)),
+          m_LocalStarts(std::move(other.m_LocalStarts))
+    {}
+
+    TimeZone& TimeZone::operator=(const TimeZone& other)
+    {
+        if (this != &other)
+        {
+            m_Name = other.m_Name;
+            m_Starts = other.m_Starts;
+            m_Offsets = other.m_Offsets;
+            m_LocalStarts = other.m_LocalStarts;
+            m_CachedInterval.store(0, std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    TimeZone& TimeZone::operator=(TimeZone&& other) noexcept
+    {
+        m_Name = std::move(other.m_Name);
+        m_Starts = std::move(other.m_Starts);
+        m_Offsets = std::move(other.m_Offsets);
+        m_LocalStarts = std::move(other.m_LocalStarts);
+        m_CachedInterval.store(0, std::memory_order_relaxed);
+        return *this;
+    }
+
+    const std::string& TimeZone::name() const noexcept
+    {
+        return m_Name;
+    }
+
+    int32_t TimeZone::getUtcOffset(PackedDateTime utc) const noexcept
+    {
+        return m_Offsets[findInterval(utc)];
+    }
+
+    DateTime TimeZone::toLocal(PackedDateTime utc) const noexcept
+    {
+        return shiftDateTime(unpack(utc), getUtcOffset(utc));
+    }
+
+    PackedDateTime TimeZone::toUtc(const DateTime& local,
+                                   LocalTimePolicy policy) const
+    {
+        PackedDateTime result;
+        toUtc(&local, 1, &result, policy);
+        return result;
+    }
+
+    void TimeZone::getUtcOffsets(const PackedDateTime* utc, size_t count,
+                                 int32_t* result) const noexcept
+    {
+        size_t hint = m_CachedInterval.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i)
+        {
+            hint = findInterval(utc[i], hint);
+            result[i] = m_Offsets[hint];
+        }
+        m_CachedInterval.store(hint, std::memory_order_relaxed);
+    }
+
+    void TimeZone::toLocal(const PackedDateTime* utc, size_t count,
+                           DateTime* result) const noexcept
+    {
+        size_t hint = m_CachedInterval.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i)
+        {
+            hint = findInterval(utc[i], hint);
+            result[i] = shiftDateTime(unpack(utc[i]), m_Offsets[hint]);
+        }
+        m_CachedInterval.store(hint, std::memory_order_relaxed);
+    }
+
+    void TimeZone::toUtc(const DateTime* local, size_t count,
+                         PackedDateTime* result, LocalTimePolicy policy) const
+    {
+        size_t hint = m_CachedInterval.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i)
+        {
+            /* Convert second 60 as 59 and add the second afterwards. */
+            auto leap = local[i].time.second == 60;
+            auto localUsecs = toLocalUnixUsecs(local[i]) - (leap ? USECS : 0);
+            auto utcUsecs = getUtcUsecs(localUsecs, hint, policy);
+            result[i] = PackedDateTime(fromUnixTimeUsecs(utcUsecs)
+                                       + (leap ? USECS_PER_SEC : 0));
+        }
+        m_CachedInterval.store(hint, std::memory_order_relaxed);
+    }
+
+    size_t TimeZone::findInterval(PackedDateTime utc, size_t hint) const noexcept
+    {
+        auto n = m_Starts.size();
+        if (m_Starts[hint] <= utc)
+        {
+            if (hint + 1 == n || utc < m_Starts[hint + 1])
+                return hint;
+            if (hint + 2 == n || utc < m_Starts[hint + 2])
+                return hint + 1;
+        }
+        auto it = std::upper_bound(m_Starts.begin(), m_Starts.end(), utc);
+        return size_t(std::distance(m_Starts.begin(), it)) - 1;
+    }
+
+    size_t TimeZone::findInterval(PackedDateTime utc) const noexcept
+    {
+        auto hint = m_CachedInterval.load(std::memory_order_relaxed);
+        auto index = findInterval(utc, hint);
+        if (index != hint)
+            m_CachedInterval.store(index, std::memory_order_relaxed);
+        return index;
+    }
+
+    int64_t TimeZone::getUtcUsecs(int64_t localUsecs, size_t& hint,
+                                  LocalTimePolicy policy) const
+    {
+        auto n = m_LocalStarts.size();
+        if (m_LocalStarts[hint] > localUsecs
+            || (hint + 1 != n && m_LocalStarts[hint + 1] <= localUsecs))
+        {
+            auto it = std::upper_bound(m_LocalStarts.begin(),
+                                       m_LocalStarts.end(), localUsecs);
+            hint = size_t(std::distance(m_LocalStarts.begin(), it)) - 1;
+        }
+
+        auto i = hint;
+        auto offset = m_Offsets[i];
+        if (i + 1 != n)
+        {
+            /* Local times from the end of interval i until the start of
+               interval i + 1 don't exist. */
+            auto end = m_LocalStarts[i + 1]
+                       + (m_Offsets[i] - m_Offsets[i + 1]) * USECS;
+            if (localUsecs >= end)
+            {
+                if (policy == LocalTimePolicy::THROW)
+                    YTIME_THROW("Local time doesn't exist in " + m_Name + ".");
+                if (policy == LocalTimePolicy::OFFSET_AFTER_TRANSITION)
+                    offset = m_Offsets[i + 1];
+            }
+        }
+        if (i != 0)
+        {
+            /* Local times before the end of interval i - 1 are
+               ambiguous. */
+            auto prevEnd = m_LocalStarts[i]
+                           + (m_Offsets[i - 1] - m_Offsets[i]) * USECS;
+            if (localUsecs < prevEnd)
+            {
+                if (policy == LocalTimePolicy::THROW)
+                    YTIME_THROW("Local time is ambiguous in " + m_Name + ".");
+                if (policy == LocalTimePolicy::OFFSET_BEFORE_TRANSITION)
+                    offset = m_Offsets[i - 1];
+            }
+        }
+        return localUsecs - offset * USECS;
+    }
+
+    TimeZone parseTzif(const char* data, size_t size, std::string name)
+    {
+        TzifReader reader(data, size);
+        auto header = readTzifHeader(reader);
+        if (header.version == 0)
+        {
+            auto transitions = readTzifBlock(reader, header, 4);
+            std::vector<PackedDateTime> times;
+            for (auto t : transitions.times)
+                times.push_back(fromUnixTime(t));
+            return {std::move(name), times, std::move(transitions.offsets)};
+        }
+
+        skipTzifBlock(reader, header, 4);
+        header = readTzifHeader(reader);
+        auto transitions = readTzifBlock(reader, header, 8);
+        if (reader.readUInt8() != '\n')
+            YTIME_THROW("The TZif footer doesn't start with a newline.");
+        auto footer = reader.readLine();
+        if (!footer.empty())
+            addRuleTransitions(transitions, PosixTzParser(footer).parse());
+
+        std::vector<PackedDateTime> times;
+        times.reserve(transitions.times.size());
+        for (auto t : transitions.times)
+            times.push_back(fromUnixTime(t));
+        return {std::move(name), times, std::move(transitions.offsets)};
+    }
+
+    TimeZone loadTimeZone(const std::string& name)
+    {
+        if (name.empty() || name.front() == '/'
+            || name.find("..") != std::string::npos)
+        {
+            YTIME_THROW("Invalid time zone name: " + name);
+        }
+
+        const char* dir = std::getenv("TZDIR");
+        auto path = std::string(dir && *dir ? dir : "/usr/share/zoneinfo")
+                    + "/" + name;
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            YTIME_THROW("Unable to open time zone file: " + path);
+        std::vector<char> data((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+        return parseTzif(data.data(), data.size(), name);
+    }
+}
@@ -0,0 +1,79 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampAnalysis.hpp"
+
+#include <algorithm>
+#include <limits>
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    TimestampAnalysis analyzeTimestamps(const PackedDateTime* values,
+                                        size_t count,
+                                        DateTimeDelta maxInterval)
+    {
+        auto limit = maxInterval.days() * int64_t(USECS_PER_DAY)
+                     + maxInterval.totalUseconds();
+        if (limit <= 0)
+            YTIME_THROW("The maximum interval must be positive.");
+
+        TimestampAnalysis result;
+        if (count < 2)
+            return result;
+
+        std::vector<int64_t> intervals(count - 1);
+        for (size_t i = 0; i < intervals.size(); ++i)
+            intervals[i] = int64_t(values[i + 1]) - int64_t(values[i]);
+
+        constexpr size_t BLOCK_SIZE = 256;
+        auto shortest = std::numeric_limits<int64_t>::max();
+        int64_t longest = 0;
+        for (size_t i = 0; i < intervals.size(); i += BLOCK_SIZE)
+        {
+            auto n = std::min(BLOCK_SIZE, intervals.size() - i);
+            auto block = intervals.data() + i;
+            bool irregular = false;
+            for (size_t k = 0; k < n; ++k)
+            {
+                auto d = block[k];
+                irregular |= (d <= 0) | (d > limit);
+                if (d > 0)
+                    shortest = std::min(shortest, d);
+                longest = std::max(longest, d);
+            }
+
+            if (!irregular)
+                continue;
+
+            for (size_t k = 0; k < n; ++k)
+            {
+                auto d = block[k];
+                auto index = i + k + 1;
+                if (d > limit)
+                    result.gaps.push_back({index, values[index - 1], Useconds(d)});
+                else if (d == 0)
+                    result.duplicates.push_back(index);
+                else if (d < 0)
+                    result.inversions.push_back(index);
+            }
+        }
+
+        auto end = std::remove_if(intervals.begin(), intervals.end(),
+                                  [](int64_t d) {return d <= 0;});
+        result.intervalCount = size_t(end - intervals.begin());
+        if (result.intervalCount == 0)
+            return result;
+
+        auto median = intervals.begin() + result.intervalCount / 2;
+        std::nth_element(intervals.begin(), median, end);
+        result.minInterval = Useconds(shortest);
+        result.maxInterval = Useconds(longest);
+        result.medianInterval = Useconds(*median);
+        return result;
+    }
+}
@@ -0,0 +1,232 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampDictionary.hpp"
+
+#include <algorithm>
+#include <limits>
+#include "Ytime/DateTimeHash.hpp"
+#include "InternalInstrumentation.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+        constexpr size_t MIN_SLOTS = 64;
+
+        template <typename Code>
+        void decodeImpl(const std::vector<PackedDateTime>& dictionary,
+                        const Code* codes, size_t count,
+                        PackedDateTime* result) noexcept
+        {
+            YTIME_TIME_BATCH(count);
+            auto values = dictionary.data();
+            for (size_t i = 0; i < count; ++i)
+                result[i] = values[codes[i]];
+        }
+
+        template <typename Code>
+        void matchRangeImpl(std::pair<uint32_t, uint32_t> range,
+                            const Code* codes, size_t count,
+                            bool* result) noexcept
+        {
+            YTIME_TIME_BATCH(count);
+            /* Codes below first wrap around to large values, a single
+               comparison checks both ends of the range. */
+            auto first = range.first;
+            auto width = range.second - range.first;
+            for (size_t i = 0; i < count; ++i)
+                result[i] = uint32_t(codes[i]) - first < width;
+        }
+    }
+
+    TimestampDictionary::TimestampDictionary() noexcept = default;
+
+    TimestampDictionary::TimestampDictionary(const PackedDateTime* values,
+                                             size_t count)
+    {
+        YTIME_TIME_BATCH(count);
+        if (count == 0)
+            return;
+
+        m_Slots.assign(MIN_SLOTS, {0, EMPTY_SLOT});
+        for (size_t i = 0; i < count; ++i)
+        {
+            /* Repeated values tend to come in runs. */
+            if (i != 0 && values[i] == values[i - 1])
+                continue;
+            auto slot = findSlot(uint64_t(values[i]));
+            if (slot->code != EMPTY_SLOT)
+                continue;
+
+            if (m_Values.size() == EMPTY_SLOT - 1)
+                YTIME_THROW("Too many unique values for a dictionary.");
+            *slot = {uint64_t(values[i]), 0};
+            m_Values.push_back(values[i]);
+
+            /* Keep the table at most half full. */
+            if (m_Values.size() * 2 > m_Slots.size())
+            {
+                m_Slots.assign(m_Slots.size() * 2, {0, EMPTY_SLOT});
+                for (auto value : m_Values)
+                    *findSlot(uint64_t(value)) = {uint64_t(value), 0};
+            }
+        }
+
+        std::sort(m_Values.begin(), m_Values.end());
+        for (size_t i = 0; i < m_Values.size(); ++i)
+            findSlot(uint64_t(m_Values[i]))->code = uint32_t(i);
+    }
+
+    const std::vector<PackedDateTime>&
+    TimestampDictionary::values() const noexcept
+    {
+        return m_Values;
+    }
+
+    size_t TimestampDictionary::size() const noexcept
+    {
+        return m_Values.size();
+    }
+
+    size_t TimestampDictionary::codeSize() const noexcept
+    {
+        if (m_Values.size() <= size_t(1) << 8)
+            return 1;
+        if (m_Values.size() <= size_t(1) << 16)
+            return 2;
+        return 4;
+    }
+
+    int64_t TimestampDictionary::find(PackedDateTime value) const noexcept
+    {
+        auto slot = findSlot(uint64_t(value));
+        if (!slot || slot->code == EMPTY_SLOT)
+            return -1;
+        return slot->code;
+    }
+
+    template <typename Code>
+    void TimestampDictionary::encodeImpl(const PackedDateTime* values,
+                                         size_t count, Code* codes) const
+    {
+        YTIME_TIME_BATCH(count);
+        if (m_Values.size() > size_t(std::numeric_limits<Code>::max()) + 1)
+            YTIME_THROW("The dictionary has too many values for the code type.");
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i != 0 && values[i] == values[i - 1])
+            {
+                codes[i] = codes[i - 1];
+                continue;
+            }
+            auto slot = findSlot(uint64_t(values[i]));
+            if (!slot || slot->code == EMPTY_SLOT)
+                YTIME_THROW("The value isn't in the dictionary.");
+            codes[i] = Code(slot->code);
+        }
+    }
+
+    void TimestampDictionary::encode(const PackedDateTime* values,
+                                     size_t count, uint8_t* codes) const
+    {
+        encodeImpl(values, count, codes);
+    }
+
+    void TimestampDictionary::encode(const PackedDateTime* values,
+                                     size_t count, uint16_t* codes) const
+    {
+        encodeImpl(values, count, codes);
+    }
+
+    void TimestampDictionary::encode(const PackedDateTime* values,
+                                     size_t count, uint32_t* codes) const
+    {
+        encodeImpl(values, count, codes);
+    }
+
+    void TimestampDictionary::decode(const uint8_t* codes, size_t count,
+                                     PackedDateTime* result) const noexcept
+    {
+        decodeImpl(m_Values, codes, count, result);
+    }
+
+    void TimestampDictionary::decode(const uint16_t* codes, size_t count,
+                                     PackedDateTime* result) const noexcept
+    {
+        decodeImpl(m_Values, codes, count, result);
+    }
+
+    void TimestampDictionary::decode(const uint32_t* codes, size_t count,
+                                     PackedDateTime* result) const noexcept
+    {
+        decodeImpl(m_Values, codes, count, result);
+    }
+
+    std::pair<uint32_t, uint32_t>
+    TimestampDictionary::findRange(PackedDateTime from,
+                                   PackedDateTime to) const noexcept
+    {
+        auto first = std::lower_bound(m_Values.begin(), m_Values.end(), from);
+        if (to <= from)
+            return {uint32_t(first - m_Values.begin()),
+                    uint32_t(first - m_Values.begin())};
+        auto last = std::lower_bound(first, m_Values.end(), to);
+        return {uint32_t(first - m_Values.begin()),
+                uint32_t(last - m_Values.begin())};
+    }
+
+    void TimestampDictionary::matchRange(const uint8_t* codes, size_t count,
+                                         PackedDateTime from,
+                                         PackedDateTime to,
+                                         bool* result) const noexcept
+    {
+        matchRangeImpl(findRange(from, to), codes, count, result);
+    }
+
+    void TimestampDictionary::matchRange(const uint16_t* codes, size_t count,
+                                         PackedDateTime from,
+                                         PackedDateTime to,
+                                         bool* result) const noexcept
+    {
+        matchRangeImpl(findRange(from, to), codes, count, result);
+    }
+
+    void TimestampDictionary::matchRange(const uint32_t* codes, size_t count,
+                                         PackedDateTime from,
+                                         PackedDateTime to,
+                                         bool* result) const noexcept
+    {
+        matchRangeImpl(findRange(from, to), codes, count, result);
+    }
+
+    TimestampDictionary::Slot*
+    TimestampDictionary::findSlot(uint64_t value) noexcept
+    {
+        auto slot = std::as_const(*this).findSlot(value);
+        return const_cast<Slot*>(slot);
+    }
+
+    const TimestampDictionary::Slot*
+    TimestampDictionary::findSlot(uint64_t value) const noexcept
+    {
+        if (m_Slots.empty())
+            return nullptr;
+        /* Linear probing, the table always has empty slots. */
+        auto mask = m_Slots.size() - 1;
+        for (auto i = size_t(mixHash(value)) & mask; ; i = (i + 1) & mask)
+        {
+            auto& slot = m_Slots[i];
+            if (slot.code == EMPTY_SLOT || slot.value == value)
+                return &slot;
+        }
+    }
+}
@@ -0,0 +1,112 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampParser.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr DateTimeFormat KNOWN_FORMATS[] = {
+            DateTimeFormat("YYYY-MM-DDTHH:mm:SS"),
+            DateTimeFormat("YYYY-MM-DDTHH:mm:SS.fff"),
+            DateTimeFormat("YYYY-MM-DDTHH:mm:SS.ffffff"),
+            DateTimeFormat("YYYY-MM-DDTHH:mm:SS.f"),
+            DateTimeFormat("YYYY-MM-DDTHH:mm:SS.ff"),
+            DateTimeFormat("YYYY-MM-DDTHH:mm:SS.ffff"),
+            DateTimeFormat("YYYY-MM-DDTHH:mm:SS.fffff"),
+            DateTimeFormat("YYYY-MM-DD HH:mm:SS"),
+            DateTimeFormat("YYYY-MM-DD HH:mm:SS.fff"),
+            DateTimeFormat("YYYY-MM-DD HH:mm:SS.ffffff"),
+            DateTimeFormat("YYYY-MM-DD HH:mm:SS.f"),
+            DateTimeFormat("YYYY-MM-DD HH:mm:SS.ff"),
+            DateTimeFormat("YYYY-MM-DD HH:mm:SS.ffff"),
+            DateTimeFormat("YYYY-MM-DD HH:mm:SS.fffff"),
+            DateTimeFormat("YYYY-MM-DD"),
+            DateTimeFormat("HH:mm:SS"),
+            DateTimeFormat("HH:mm:SS.fff"),
+            DateTimeFormat("HH:mm:SS.ffffff"),
+            DateTimeFormat("HH:mm:SS.f"),
+            DateTimeFormat("HH:mm:SS.ff"),
+            DateTimeFormat("HH:mm:SS.ffff"),
+            DateTimeFormat("HH:mm:SS.fffff"),
+            DateTimeFormat("YYYYMMDDTHHmmSS"),
+            DateTimeFormat("YYYYMMDDTHHmmSS.fff"),
+            DateTimeFormat("YYYYMMDDTHHmmSS.ffffff"),
+            DateTimeFormat("YYYYMMDDHHmmSS"),
+            DateTimeFormat("YYYYMMDDHHmmSS.fff"),
+            DateTimeFormat("YYYYMMDDHHmmSS.ffffff"),
+            DateTimeFormat("YYYYMMDD")
+        };
+
+        constexpr size_t KNOWN_FORMATS_SIZE = std::size(KNOWN_FORMATS);
+    }
+
+    std::optional<DateTime>
+    TimestampParser::parseDateTime(std::string_view str) const
+    {
+        if (m_Format)
+        {
+            if (auto dt = m_Format->parseDateTime(str))
+                return dt;
+        }
+        return parseFallback(str);
+    }
+
+    std::optional<PackedDateTime>
+    TimestampParser::parse(std::string_view str) const
+    {
+        auto dt = parseDateTime(str);
+        if (!dt || dt->date.year == 0)
+            return {};
+        return pack(*dt);
+    }
+
+    std::optional<DateTime>
+    TimestampParser::parseFallback(std::string_view str) const
+    {
+        for (auto& format : KNOWN_FORMATS)
+        {
+            if (format.length() != str.size())
+                continue;
+            if (auto dt = format.parseDateTime(str))
+                return dt;
+        }
+
+        auto dt = Ytime::parseDateTime(str);
+        if (!dt)
+            return {};
+        if (dt->date.year == 0 ? !isValid(dt->time, true) : !isValid(*dt))
+            return {};
+        return dt;
+    }
+
+    TimestampParser
+    detectTimestampParser(const std::string_view* samples, size_t count)
+    {
+        size_t matches[KNOWN_FORMATS_SIZE] = {};
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (size_t j = 0; j < KNOWN_FORMATS_SIZE; ++j)
+            {
+                if (KNOWN_FORMATS[j].length() == samples[i].size()
+                    && KNOWN_FORMATS[j].parseDateTime(samples[i]))
+                {
+                    ++matches[j];
+                }
+            }
+        }
+
+        auto best = std::max_element(std::begin(matches), std::end(matches));
+        if (*best == 0)
+            return {};
+        return TimestampParser(KNOWN_FORMATS[best - std::begin(matches)]);
+    }
+}
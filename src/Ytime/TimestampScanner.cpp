@@ -0,0 +1,291 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampScanner.hpp"
+
+#include <cstring>
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+#include "InternalInstrumentation.hpp"
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define YTIME_SCANNER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define YTIME_SCANNER_SSE2
+#endif
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr size_t NOT_FOUND = std::string_view::npos;
+
+        int countTrailingZeros(uint32_t bits) noexcept
+        {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctz(bits);
+        #else
+            int n = 0;
+            while ((bits & 1u) == 0)
+            {
+                bits >>= 1u;
+                ++n;
+            }
+            return n;
+        #endif
+        }
+
+        bool isDigit(char c) noexcept
+        {
+            return unsigned(c) - '0' <= 9;
+        }
+
+        int toInt(const char* s, size_t n) noexcept
+        {
+            int value = 0;
+            for (size_t i = 0; i < n; ++i)
+                value = value * 10 + (s[i] - '0');
+            return value;
+        }
+
+        /* Returns true if there is a YYYY-MM-DD at s that isn't preceded
+           by a digit. The dashes have already been checked. */
+        bool isDateCandidate(const char* data, size_t s, size_t size) noexcept
+        {
+            return s + 10 <= size
+                   && (s == 0 || !isDigit(data[s - 1]))
+                   && isDigit(data[s]) && isDigit(data[s + 1])
+                   && isDigit(data[s + 2]) && isDigit(data[s + 3])
+                   && isDigit(data[s + 5]) && isDigit(data[s + 6])
+                   && isDigit(data[s + 8]) && isDigit(data[s + 9]);
+        }
+
+        /* Returns the start of the first date candidate at or after pos,
+           or NOT_FOUND. i is the position of the candidate's first dash. */
+        size_t findCandidate(const char* data, size_t pos, size_t size) noexcept
+        {
+            if (pos > size)
+                return NOT_FOUND;
+            size_t i = pos + 4;
+        #if defined(YTIME_SCANNER_AVX2)
+            const auto dash = _mm256_set1_epi8('-');
+            for (; i + 3 + 32 <= size; i += 32)
+            {
+                auto a = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + i));
+                auto b = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + i + 3));
+                auto mask = uint32_t(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(a, dash),
+                                     _mm256_cmpeq_epi8(b, dash))));
+                for (; mask != 0; mask &= mask - 1)
+                {
+                    auto s = i + countTrailingZeros(mask) - 4;
+                    if (isDateCandidate(data, s, size))
+                        return s;
+                }
+            }
+        #elif defined(YTIME_SCANNER_SSE2)
+            const auto dash = _mm_set1_epi8('-');
+            for (; i + 3 + 16 <= size; i += 16)
+            {
+                auto a = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + i));
+                auto b = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + i + 3));
+                auto mask = uint32_t(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(a, dash),
+                                  _mm_cmpeq_epi8(b, dash))));
+                for (; mask != 0; mask &= mask - 1)
+                {
+                    auto s = i + countTrailingZeros(mask) - 4;
+                    if (isDateCandidate(data, s, size))
+                        return s;
+                }
+            }
+        #endif
+            for (; i + 6 <= size; ++i)
+            {
+                if (data[i] == '-' && data[i + 3] == '-'
+                    && isDateCandidate(data, i - 4, size))
+                {
+                    return i - 4;
+                }
+            }
+            return NOT_FOUND;
+        }
+
+        bool isTime(const char* s) noexcept
+        {
+            return isDigit(s[0]) && isDigit(s[1]) && s[2] == ':'
+                   && isDigit(s[3]) && isDigit(s[4]) && s[5] == ':'
+                   && isDigit(s[6]) && isDigit(s[7]);
+        }
+
+        /* Parses a UTC offset at pos. Returns the offset in minutes and
+           updates pos, or returns 0 and leaves pos unchanged. */
+        int parseOffset(const char* data, size_t& pos, size_t size) noexcept
+        {
+            if (pos == size)
+                return 0;
+            if (data[pos] == 'Z')
+            {
+                ++pos;
+                return 0;
+            }
+            if (data[pos] != '+' && data[pos] != '-')
+                return 0;
+            auto s = data + pos + 1;
+            size_t n;
+            if (pos + 6 <= size && isDigit(s[0]) && isDigit(s[1])
+                && s[2] == ':' && isDigit(s[3]) && isDigit(s[4]))
+            {
+                n = 6;
+            }
+            else if (pos + 5 <= size && isDigit(s[0]) && isDigit(s[1])
+                     && isDigit(s[2]) && isDigit(s[3]))
+            {
+                n = 5;
+            }
+            else
+            {
+                return 0;
+            }
+            auto hours = toInt(s, 2);
+            auto minutes = toInt(s + n - 3, 2);
+            if (hours > 23 || minutes > 59)
+                return 0;
+            auto sign = data[pos] == '-' ? -1 : 1;
+            pos += n;
+            return sign * (hours * 60 + minutes);
+        }
+
+        /* Parses the timestamp at s, which is a date candidate. */
+        std::optional<TimestampMatch>
+        parseCandidate(const char* data, size_t s, size_t size) noexcept
+        {
+            DateTime dt({toInt(data + s, 4), toInt(data + s + 5, 2),
+                         toInt(data + s + 8, 2)},
+                        {0, 0, 0});
+            auto pos = s + 10;
+            int offset = 0;
+            if (pos + 9 <= size && (data[pos] == 'T' || data[pos] == ' ')
+                && isTime(data + pos + 1))
+            {
+                auto t = data + pos + 1;
+                dt.time = {toInt(t, 2), toInt(t + 3, 2), toInt(t + 6, 2)};
+                pos += 9;
+                if (pos + 1 < size && data[pos] == '.' && isDigit(data[pos + 1]))
+                {
+                    ++pos;
+                    int digits = 0;
+                    for (; pos < size && isDigit(data[pos]) && digits < 9;
+                         ++pos, ++digits)
+                    {
+                        if (digits < 6)
+                            dt.time.usecond = dt.time.usecond * 10
+                                              + (data[pos] - '0');
+                    }
+                    for (; digits < 6; ++digits)
+                        dt.time.usecond *= 10;
+                }
+                offset = parseOffset(data, pos, size);
+            }
+
+            if (pos < size && isDigit(data[pos]))
+                return {};
+
+            if (offset != 0)
+            {
+                /* The local time is checked before it's shifted, the
+                   UTC time is validated below. */
+                auto& t = dt.time;
+                if (!isValid(dt.date) || t.hour > 23 || t.minute > 59
+                    || t.second > 60)
+                {
+                    return {};
+                }
+                auto days = int64_t(Detail::daysSinceEpochYMD(dt.date));
+                auto minutes = int64_t(dt.time.hour * 60 + dt.time.minute
+                                       - offset);
+                auto dayShift = Detail::floorDiv(minutes, 24 * 60);
+                days += dayShift;
+                minutes -= dayShift * 24 * 60;
+                if (days < 0)
+                    return {};
+                dt.date = Detail::toYMD(uint64_t(days));
+                dt.time.hour = int(minutes / 60);
+                dt.time.minute = int(minutes % 60);
+            }
+
+            if (!isValid(dt))
+                return {};
+            return TimestampMatch{s, pos - s, pack(dt)};
+        }
+
+        std::optional<TimestampMatch>
+        findTimestamp(const char* data, size_t pos, size_t size) noexcept
+        {
+            while (true)
+            {
+                auto s = findCandidate(data, pos, size);
+                if (s == NOT_FOUND)
+                    return {};
+                if (auto match = parseCandidate(data, s, size))
+                    return match;
+                pos = s + 1;
+            }
+        }
+    }
+
+    std::optional<TimestampMatch>
+    findTimestamp(std::string_view str, size_t pos) noexcept
+    {
+        YTIME_COUNT(calls);
+        return findTimestamp(str.data(), pos, str.size());
+    }
+
+    void findTimestamps(std::string_view buffer,
+                        std::vector<TimestampMatch>& result)
+    {
+        YTIME_TIME_BATCH(buffer.size());
+        size_t pos = 0;
+        while (auto match = findTimestamp(buffer.data(), pos, buffer.size()))
+        {
+            result.push_back(*match);
+            pos = match->offset + match->length;
+        }
+    }
+
+    void findLineTimestamps(std::string_view buffer,
+                            std::vector<TimestampMatch>& result)
+    {
+        YTIME_TIME_BATCH(buffer.size());
+        auto data = buffer.data();
+        size_t pos = 0;
+        while (pos < buffer.size())
+        {
+            auto end = static_cast<const char*>(
+                std::memchr(data + pos, '\n', buffer.size() - pos));
+            auto lineEnd = end ? size_t(end - data) : buffer.size();
+            /* The line is scanned as a separate string to stop the search
+               at the end of the line. */
+            auto match = findTimestamp(data + pos, 0, lineEnd - pos);
+            if (match)
+            {
+                match->offset += pos;
+                result.push_back(*match);
+            }
+            else
+            {
+                result.push_back({pos, 0, {}});
+            }
+            pos = lineEnd + 1;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampStream.hpp"
+
+#include <algorithm>
+#include "InternalInstrumentation.hpp"
+#include "YtimeThrow.hpp"
+
+namespace Ytime
+{
+    TimestampStream::TimestampStream(const TimestampParser& parser,
+                                     size_t maxBatchSize,
+                                     PackedDateTime invalidValue)
+        : m_Parser(parser),
+          m_MaxBatchSize(maxBatchSize),
+          m_InvalidValue(invalidValue)
+    {
+        if (maxBatchSize == 0)
+            YTIME_THROW("The batch size must be at least 1.");
+        m_Batch.reserve(maxBatchSize);
+    }
+
+    bool TimestampStream::needsInput() const noexcept
+    {
+        return !m_Closed && m_Chunk.empty();
+    }
+
+    bool TimestampStream::atEnd() const noexcept
+    {
+        return m_Closed && m_Chunk.empty() && m_Partial.empty();
+    }
+
+    void TimestampStream::write(std::string_view chunk)
+    {
+        if (m_Closed)
+            YTIME_THROW("Can not write to a closed stream.");
+        if (!m_Chunk.empty())
+            YTIME_THROW("The previous chunk hasn't been read.");
+        m_Chunk = chunk;
+    }
+
+    void TimestampStream::close()
+    {
+        m_Closed = true;
+    }
+
+    const std::vector<PackedDateTime>& TimestampStream::read()
+    {
+        YTIME_COUNT(calls);
+        m_Batch.clear();
+        PackedDateTime value;
+        while (m_Batch.size() < m_MaxBatchSize && parseNext(value))
+            m_Batch.push_back(value);
+        return m_Batch;
+    }
+
+    size_t TimestampStream::maxBatchSize() const noexcept
+    {
+        return m_MaxBatchSize;
+    }
+
+    bool TimestampStream::parseNext(PackedDateTime& value)
+    {
+        auto pos = m_Chunk.find('\n');
+        if (pos == std::string_view::npos)
+        {
+            if (!m_Closed)
+            {
+                /* The line continues in the next chunk, which may be
+                   written to the same buffer as this one. */
+                if (!m_Chunk.empty())
+                {
+                    YTIME_COUNT(slowPaths);
+                    m_Partial.append(m_Chunk);
+                    m_Chunk = {};
+                }
+                return false;
+            }
+            if (m_Chunk.empty() && m_Partial.empty())
+                return false;
+            pos = m_Chunk.size();
+        }
+
+        auto line = m_Chunk.substr(0, pos);
+        m_Chunk.remove_prefix(std::min(pos + 1, m_Chunk.size()));
+        if (m_Partial.empty())
+        {
+            value = parseLine(line);
+        }
+        else
+        {
+            m_Partial.append(line);
+            value = parseLine(m_Partial);
+            m_Partial.clear();
+        }
+        return true;
+    }
+
+    PackedDateTime TimestampStream::parseLine(std::string_view line) const
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        return m_Parser.parse(line).value_or(m_InvalidValue);
+    }
+}
@@ -0,0 +1,271 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/UnixTime.hpp"
+
+#include <limits>
+#include "Ytime/Detail/LeapSecondTable.hpp"
+#include "InternalInstrumentation.hpp"
+
+namespace Ytime
+{
+    namespace
+    {
+        constexpr int64_t UNIX_EPOCH_USECS =
+            Detail::UNIX_EPOCH_DAYS * USECS_PER_DAY;
+        constexpr int64_t NTP_UNIX_OFFSET_SECS = 2208988800;
+        constexpr int64_t NTP_ERA_SECS = int64_t(1) << 32;
+        constexpr int64_t USECS = USECS_PER_SEC;
+
+        /* The values where the leap second offset changes, either as
+           PackedDateTime or as Unix time in microseconds. */
+        struct Bounds
+        {
+            const int64_t* values;
+            size_t size;
+        };
+
+        Bounds getPackedBounds() noexcept
+        {
+            auto& table = Detail::getLeapSecondData();
+            return {table.packedBounds, table.size};
+        }
+
+        Bounds getUnixBounds() noexcept
+        {
+            auto& table = Detail::getLeapSecondData();
+            return {table.unixBounds, table.size};
+        }
+
+        int64_t countLeapSeconds(const Bounds& bounds, int64_t usecs) noexcept
+        {
+            return std::upper_bound(bounds.values, bounds.values + bounds.size,
+                                    usecs)
+                   - bounds.values;
+        }
+
+        int64_t packedToUnixUsecs(PackedDateTime dateTime,
+                                  int64_t leapSecs) noexcept
+        {
+            return int64_t(dateTime) - UNIX_EPOCH_USECS - leapSecs * USECS;
+        }
+
+        PackedDateTime unixUsecsToPacked(int64_t usecs,
+                                         int64_t leapSecs) noexcept
+        {
+            return PackedDateTime(usecs + UNIX_EPOCH_USECS + leapSecs * USECS);
+        }
+
+        constexpr uint64_t usecsToNtpFraction(int64_t usecs) noexcept
+        {
+            return ((uint64_t(usecs) << 32u) + USECS_PER_SEC - 1)
+                   / USECS_PER_SEC;
+        }
+
+        constexpr uint64_t makeNtpTimestamp(int64_t unixUsecs) noexcept
+        {
+            auto secs = Detail::floorDiv(unixUsecs, USECS);
+            auto frac = usecsToNtpFraction(unixUsecs - secs * USECS);
+            return (uint64_t(secs + NTP_UNIX_OFFSET_SECS) << 32u) | frac;
+        }
+
+        constexpr int64_t
+        ntpTimestampToUnixUsecs(uint64_t timestamp, int era) noexcept
+        {
+            auto secs = era * NTP_ERA_SECS + int64_t(timestamp >> 32u)
+                        - NTP_UNIX_OFFSET_SECS;
+            auto usecs = ((timestamp & 0xFFFFFFFFu) * USECS_PER_SEC) >> 32u;
+            return secs * USECS + int64_t(usecs);
+        }
+
+        /* Converts the values in blocks. If all the values in a block
+           have the same leap second offset, which is almost always the
+           case with sorted input, the block is converted with a single
+           offset in a loop the compiler can vectorize. Otherwise the
+           offset is looked up for each value. */
+        template <typename In, typename Out, typename KeyFunc, typename ConvFunc>
+        void convertBatch(const In* values, size_t count, Out* result,
+                          Bounds bounds, KeyFunc key, ConvFunc convert)
+        {
+            YTIME_TIME_BATCH(count);
+            constexpr size_t BLOCK_SIZE = 256;
+            for (size_t i = 0; i < count; i += BLOCK_SIZE)
+            {
+                auto n = std::min(BLOCK_SIZE, count - i);
+                auto in = values + i;
+                auto out = result + i;
+
+                auto leapSecs = countLeapSeconds(bounds, key(in[0]));
+                auto lower = leapSecs == 0
+                             ? std::numeric_limits<int64_t>::min()
+                             : bounds.values[leapSecs - 1];
+                auto upper = size_t(leapSecs) == bounds.size
+                             ? std::numeric_limits<int64_t>::max()
+                             : bounds.values[leapSecs];
+                bool inside = true;
+                for (size_t j = 0; j < n; ++j)
+                {
+                    auto k = key(in[j]);
+                    inside &= (lower <= k) & (k < upper);
+                }
+
+                if (inside)
+                {
+                    for (size_t j = 0; j < n; ++j)
+                        out[j] = convert(in[j], leapSecs);
+                }
+                else
+                {
+                    YTIME_COUNT(slowPaths);
+                    for (size_t j = 0; j < n; ++j)
+                        out[j] = convert(in[j], countLeapSeconds(bounds, key(in[j])));
+                }
+            }
+        }
+
+        int64_t packedKey(PackedDateTime dateTime) noexcept
+        {
+            return int64_t(dateTime);
+        }
+    }
+
+    PackedDateTime fromUnixTime(int64_t secs) noexcept
+    {
+        return fromUnixTimeUsecs(secs * USECS);
+    }
+
+    PackedDateTime fromUnixTimeUsecs(int64_t usecs) noexcept
+    {
+        return unixUsecsToPacked(usecs, countLeapSeconds(getUnixBounds(), usecs));
+    }
+
+    PackedDateTime fromUnixTimeNsecs(int64_t nsecs) noexcept
+    {
+        return fromUnixTimeUsecs(Detail::floorDiv(nsecs, 1000));
+    }
+
+    PackedDateTime fromTimespec(const timespec& ts) noexcept
+    {
+        return fromUnixTimeUsecs(int64_t(ts.tv_sec) * USECS
+                                 + Detail::floorDiv(ts.tv_nsec, 1000));
+    }
+
+    int64_t toUnixTime(PackedDateTime dateTime) noexcept
+    {
+        return Detail::floorDiv(toUnixTimeUsecs(dateTime), USECS);
+    }
+
+    int64_t toUnixTimeUsecs(PackedDateTime dateTime) noexcept
+    {
+        auto leapSecs = countLeapSeconds(getPackedBounds(), int64_t(dateTime));
+        return packedToUnixUsecs(dateTime, leapSecs);
+    }
+
+    int64_t toUnixTimeNsecs(PackedDateTime dateTime) noexcept
+    {
+        return toUnixTimeUsecs(dateTime) * 1000;
+    }
+
+    timespec toTimespec(PackedDateTime dateTime) noexcept
+    {
+        auto usecs = toUnixTimeUsecs(dateTime);
+        auto secs = Detail::floorDiv(usecs, USECS);
+        timespec result = {};
+        result.tv_sec = time_t(secs);
+        result.tv_nsec = long((usecs - secs * USECS) * 1000);
+        return result;
+    }
+
+    void fromUnixTime(const int64_t* values, size_t count,
+                      PackedDateTime* result) noexcept
+    {
+        convertBatch(values, count, result, getUnixBounds(),
+                     [](int64_t s) {return s * USECS;},
+                     [](int64_t s, int64_t ls)
+                     {return unixUsecsToPacked(s * USECS, ls);});
+    }
+
+    void fromUnixTimeUsecs(const int64_t* values, size_t count,
+                           PackedDateTime* result) noexcept
+    {
+        convertBatch(values, count, result, getUnixBounds(),
+                     [](int64_t us) {return us;},
+                     unixUsecsToPacked);
+    }
+
+    void fromUnixTimeNsecs(const int64_t* values, size_t count,
+                           PackedDateTime* result) noexcept
+    {
+        convertBatch(values, count, result, getUnixBounds(),
+                     [](int64_t ns) {return Detail::floorDiv(ns, 1000);},
+                     [](int64_t ns, int64_t ls)
+                     {
+                         return unixUsecsToPacked(Detail::floorDiv(ns, 1000),
+                                                  ls);
+                     });
+    }
+
+    void toUnixTime(const PackedDateTime* values, size_t count,
+                    int64_t* result) noexcept
+    {
+        convertBatch(values, count, result, getPackedBounds(), packedKey,
+                     [](PackedDateTime t, int64_t ls)
+                     {
+                         return Detail::floorDiv(packedToUnixUsecs(t, ls),
+                                                 USECS);
+                     });
+    }
+
+    void toUnixTimeUsecs(const PackedDateTime* values, size_t count,
+                         int64_t* result) noexcept
+    {
+        convertBatch(values, count, result, getPackedBounds(), packedKey,
+                     packedToUnixUsecs);
+    }
+
+    void toUnixTimeNsecs(const PackedDateTime* values, size_t count,
+                         int64_t* result) noexcept
+    {
+        convertBatch(values, count, result, getPackedBounds(), packedKey,
+                     [](PackedDateTime t, int64_t ls)
+                     {return packedToUnixUsecs(t, ls) * 1000;});
+    }
+
+    PackedDateTime fromNtpTimestamp(uint64_t timestamp, int era) noexcept
+    {
+        return fromUnixTimeUsecs(ntpTimestampToUnixUsecs(timestamp, era));
+    }
+
+    uint64_t toNtpTimestamp(PackedDateTime dateTime) noexcept
+    {
+        return makeNtpTimestamp(toUnixTimeUsecs(dateTime));
+    }
+
+    int getNtpEra(PackedDateTime dateTime) noexcept
+    {
+        auto secs = toUnixTime(dateTime) + NTP_UNIX_OFFSET_SECS;
+        return int(Detail::floorDiv(secs, NTP_ERA_SECS));
+    }
+
+    void fromNtpTimestamp(const uint64_t* values, size_t count,
+                          PackedDateTime* result, int era) noexcept
+    {
+        convertBatch(values, count, result, getUnixBounds(),
+                     [era](uint64_t ts)
+                     {return ntpTimestampToUnixUsecs(ts, era);},
+                     [era](uint64_t ts, int64_t ls)
+                     {return unixUsecsToPacked(ntpTimestampToUnixUsecs(ts, era), ls);});
+    }
+
+    void toNtpTimestamp(const PackedDateTime* values, size_t count,
+                        uint64_t* result) noexcept
+    {
+        convertBatch(values, count, result, getPackedBounds(), packedKey,
+                     [](PackedDateTime t, int64_t ls)
+                     {return makeNtpTimestamp(packedToUnixUsecs(t, ls));});
+    }
+}
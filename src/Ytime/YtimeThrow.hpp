@@ -6,10 +6,13 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <string>
 #include "Ytime/YtimeException.hpp"
+#include "InternalInstrumentation.hpp"
 
 #define _YTIME_THROW_3(file, line, msg) \
-    throw ::Ytime::YtimeException(file ":" #line ": " msg)
+    (YTIME_COUNT(throws), \
+     throw ::Ytime::YtimeException(std::string(file ":" #line ": ") + (msg)))
 
 #define _YTIME_THROW_2(file, line, msg) \
     _YTIME_THROW_3(file, line, msg)
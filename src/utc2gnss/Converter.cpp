@@ -0,0 +1,378 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Converter.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include "Ytime/AstronomicalTime.hpp"
+#include "Ytime/ConversionWorkspace.hpp"
+#include "Ytime/DateTimeFormat.hpp"
+#include "Ytime/GpsTime.hpp"
+#include "Ytime/TimestampParser.hpp"
+#include "Ytime/UnixTime.hpp"
+
+namespace Utc2Gnss
+{
+    using namespace Ytime;
+
+    namespace
+    {
+        constexpr DateTimeFormat ISO_FORMAT("YYYY-MM-DDTHH:mm:SS.ffffff");
+
+        /* The longest line any output format produces. */
+        constexpr size_t MAX_LINE_LENGTH = 48;
+
+        constexpr size_t SAMPLE_COUNT = 100;
+
+        constexpr int64_t POWERS_OF_TEN[] = {
+            1, 10, 100, 1000, 10000, 100000, 1000000, 10000000,
+            100000000, 1000000000, 10000000000, 100000000000
+        };
+
+        int64_t floorDiv(int64_t n, int64_t d) noexcept
+        {
+            auto q = n / d;
+            return q * d <= n ? q : q - 1;
+        }
+
+        /* A decimal number split into a signed integer part and a
+           fraction with fractionDigits digits. */
+        struct Decimal
+        {
+            bool negative = false;
+            int64_t whole = 0;
+            int64_t fraction = 0;
+            int fractionDigits = 0;
+        };
+
+        std::optional<Decimal> parseDecimal(std::string_view str,
+                                            int maxDigits)
+        {
+            Decimal result;
+            if (!str.empty() && str[0] == '-')
+            {
+                result.negative = true;
+                str.remove_prefix(1);
+            }
+            /* from_chars would accept a second '-'. */
+            if (str.empty() || unsigned(str[0]) - '0' > 9)
+                return {};
+            auto end = str.data() + str.size();
+            auto [ptr, ec] = std::from_chars(str.data(), end, result.whole);
+            if (ec != std::errc() || ptr == str.data())
+                return {};
+            if (ptr != end)
+            {
+                if (*ptr++ != '.' || ptr == end)
+                    return {};
+                for (; ptr != end; ++ptr)
+                {
+                    auto digit = unsigned(*ptr) - '0';
+                    if (digit > 9)
+                        return {};
+                    /* Digits beyond maxDigits are truncated. */
+                    if (result.fractionDigits < maxDigits)
+                    {
+                        result.fraction = result.fraction * 10 + int64_t(digit);
+                        ++result.fractionDigits;
+                    }
+                }
+            }
+            return result;
+        }
+
+        /* Returns the decimal as an integer in units of 10^-digits. */
+        int64_t toFixedPoint(const Decimal& d, int digits)
+        {
+            auto value = d.whole * POWERS_OF_TEN[digits]
+                         + d.fraction * POWERS_OF_TEN[digits - d.fractionDigits];
+            return d.negative ? -value : value;
+        }
+
+        std::optional<PackedDateTime> parseMjd(std::string_view str)
+        {
+            auto d = parseDecimal(str, 11);
+            if (!d)
+                return {};
+            DayFraction mjd{d->whole, double(d->fraction)
+                                      / double(POWERS_OF_TEN[d->fractionDigits])};
+            if (d->negative)
+            {
+                mjd.day = -mjd.day;
+                if (mjd.fraction != 0)
+                {
+                    mjd.day -= 1;
+                    mjd.fraction = 1 - mjd.fraction;
+                }
+            }
+            return fromModifiedJulianDay(mjd);
+        }
+
+        std::optional<PackedDateTime> parseGps(std::string_view str)
+        {
+            auto sep = str.find_first_of(" \t,");
+            if (sep == std::string_view::npos)
+                return {};
+            int64_t week = 0;
+            auto weekStr = str.substr(0, sep);
+            auto end = weekStr.data() + weekStr.size();
+            auto [ptr, ec] = std::from_chars(weekStr.data(), end, week);
+            if (ec != std::errc() || ptr != end)
+                return {};
+            auto towPos = str.find_first_not_of(" \t,", sep);
+            if (towPos == std::string_view::npos)
+                return {};
+            auto tow = parseDecimal(str.substr(towPos), 6);
+            if (!tow)
+                return {};
+            return fromGpsTime({week, toFixedPoint(*tow, 6)});
+        }
+
+        std::optional<PackedDateTime> parseRecord(std::string_view str,
+                                                  TimeFormat format,
+                                                  const TimestampParser& parser)
+        {
+            switch (format)
+            {
+            case TimeFormat::ISO:
+                if (!str.empty() && (str.back() == 'Z' || str.back() == 'z'))
+                    str.remove_suffix(1);
+                return parser.parse(str);
+            case TimeFormat::UNIX:
+                if (auto d = parseDecimal(str, 6))
+                    return fromUnixTimeUsecs(toFixedPoint(*d, 6));
+                return {};
+            case TimeFormat::UNIX_US:
+                if (auto d = parseDecimal(str, 0); d && d->fractionDigits == 0)
+                    return fromUnixTimeUsecs(toFixedPoint(*d, 0));
+                return {};
+            case TimeFormat::MJD:
+                return parseMjd(str);
+            case TimeFormat::GPS:
+                return parseGps(str);
+            }
+            return {};
+        }
+
+        char* writeInt(char* pos, int64_t value)
+        {
+            return std::to_chars(pos, pos + 24, value).ptr;
+        }
+
+        /* Writes value as a decimal with exactly digits decimals. */
+        char* writeFixedPoint(char* pos, int64_t value, int digits)
+        {
+            auto whole = floorDiv(value, POWERS_OF_TEN[digits]);
+            auto fraction = value - whole * POWERS_OF_TEN[digits];
+            /* -0.5 is written as -0.500000, not -1.500000. */
+            if (whole < 0 && fraction != 0)
+            {
+                *pos++ = '-';
+                whole = -whole - 1;
+                fraction = POWERS_OF_TEN[digits] - fraction;
+            }
+            pos = writeInt(pos, whole);
+            *pos++ = '.';
+            for (int i = digits - 1; i >= 0; --i)
+            {
+                pos[i] = char('0' + fraction % 10);
+                fraction /= 10;
+            }
+            return pos + digits;
+        }
+
+        /* Converts the values to format and appends them to output. */
+        void formatValues(WorkspaceArray<PackedDateTime> values,
+                          WorkspaceArray<bool> valid,
+                          TimeFormat format, std::string& output,
+                          ConversionWorkspace& workspace)
+        {
+            auto count = values.size();
+            WorkspaceArray<int64_t> ints;
+            WorkspaceArray<DayFraction> days;
+            switch (format)
+            {
+            case TimeFormat::UNIX:
+            case TimeFormat::UNIX_US:
+                ints = workspace.allocate<int64_t>(count);
+                toUnixTimeUsecs(values.data(), count, ints.data());
+                break;
+            case TimeFormat::GPS:
+                ints = workspace.allocate<int64_t>(count);
+                toGpsTimeUsecs(values.data(), count, ints.data());
+                break;
+            case TimeFormat::MJD:
+                days = workspace.allocate<DayFraction>(count);
+                toModifiedJulianDay(values.data(), count, days.data());
+                break;
+            default:
+                break;
+            }
+
+            auto size = output.size();
+            output.resize(size + count * MAX_LINE_LENGTH);
+            auto pos = &output[size];
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!valid[i])
+                {
+                    std::memcpy(pos, "invalid\n", 8);
+                    pos += 8;
+                    continue;
+                }
+
+                switch (format)
+                {
+                case TimeFormat::ISO:
+                    if (auto n = StaticDateTimeFormat<ISO_FORMAT>::format(
+                            values[i], pos, MAX_LINE_LENGTH))
+                    {
+                        pos += n;
+                        *pos++ = 'Z';
+                    }
+                    else
+                    {
+                        /* The year has more than four digits. */
+                        std::memcpy(pos, "invalid", 7);
+                        pos += 7;
+                    }
+                    break;
+                case TimeFormat::UNIX:
+                    pos = writeFixedPoint(pos, ints[i], 6);
+                    break;
+                case TimeFormat::UNIX_US:
+                    pos = writeInt(pos, ints[i]);
+                    break;
+                case TimeFormat::MJD:
+                {
+                    auto fraction = std::llround(days[i].fraction * 1e11);
+                    pos = writeFixedPoint(pos, days[i].day * POWERS_OF_TEN[11]
+                                               + fraction, 11);
+                    break;
+                }
+                case TimeFormat::GPS:
+                {
+                    auto week = floorDiv(ints[i], USECS_PER_GPS_WEEK);
+                    pos = writeInt(pos, week);
+                    *pos++ = ' ';
+                    pos = writeFixedPoint(pos, ints[i] - week * USECS_PER_GPS_WEEK,
+                                          6);
+                    break;
+                }
+                }
+                *pos++ = '\n';
+            }
+            output.resize(size_t(pos - output.data()));
+        }
+
+        WorkspaceArray<PackedDateTime>
+        parseBinary(std::string_view input, TimeFormat format,
+                    ConversionWorkspace& workspace)
+        {
+            auto ints = workspace.allocate<int64_t>(input.size()
+                                                    / sizeof(int64_t));
+            std::memcpy(ints.data(), input.data(), ints.size() * sizeof(int64_t));
+            auto values = workspace.allocate<PackedDateTime>(ints.size());
+            switch (format)
+            {
+            case TimeFormat::UNIX:
+                fromUnixTime(ints.data(), ints.size(), values.data());
+                break;
+            case TimeFormat::UNIX_US:
+                fromUnixTimeUsecs(ints.data(), ints.size(), values.data());
+                break;
+            default:
+                fromGpsTimeUsecs(ints.data(), ints.size(), values.data());
+                break;
+            }
+            return values;
+        }
+    }
+
+    std::optional<TimeFormat> parseTimeFormat(std::string_view name)
+    {
+        if (name == "iso")
+            return TimeFormat::ISO;
+        if (name == "unix")
+            return TimeFormat::UNIX;
+        if (name == "unix-us")
+            return TimeFormat::UNIX_US;
+        if (name == "mjd")
+            return TimeFormat::MJD;
+        if (name == "gps")
+            return TimeFormat::GPS;
+        return {};
+    }
+
+    void convertChunk(Chunk& chunk, const ConverterOptions& options)
+    {
+        /* Each worker thread reuses its workspace for every chunk. */
+        thread_local ConversionWorkspace workspace;
+        workspace.reset();
+
+        WorkspaceArray<PackedDateTime> values;
+        WorkspaceArray<bool> valid;
+        if (options.binary)
+        {
+            values = parseBinary(chunk.input, options.from, workspace);
+            valid = workspace.allocate<bool>(values.size());
+            std::fill(valid.begin(), valid.end(), true);
+        }
+        else
+        {
+            auto lines = splitLines(chunk.input, workspace);
+            /* Empty lines are skipped. */
+            auto end = std::remove_if(lines.begin(), lines.end(),
+                                      [](auto& s) {return s.empty();});
+            lines = {lines.data(), size_t(end - lines.begin())};
+
+            TimestampParser parser;
+            if (options.from == TimeFormat::ISO)
+            {
+                auto n = std::min(lines.size(), SAMPLE_COUNT);
+                parser = detectTimestampParser(lines.data(), n);
+            }
+            values = workspace.allocate<PackedDateTime>(lines.size());
+            valid = workspace.allocate<bool>(lines.size());
+            for (size_t i = 0; i < lines.size(); ++i)
+            {
+                auto value = parseRecord(lines[i], options.from, parser);
+                valid[i] = value.has_value();
+                if (value)
+                    values[i] = *value;
+                else
+                    ++chunk.errors;
+            }
+        }
+
+        chunk.rows = values.size();
+        formatValues(values, valid, options.to, chunk.output, workspace);
+    }
+
+    void generateInput(FILE* file, size_t count)
+    {
+        constexpr size_t BLOCK_SIZE = 4096;
+        constexpr DateTimeFormat format("YYYY-MM-DDTHH:mm:SS.ffffffZ");
+        auto start = pack({{2016, 12, 31}, {0, 0, 0}});
+        std::string buffer(BLOCK_SIZE * (format.length() + 1), '\n');
+        for (size_t i = 0; i < count; i += BLOCK_SIZE)
+        {
+            auto n = std::min(BLOCK_SIZE, count - i);
+            auto pos = buffer.data();
+            for (size_t j = 0; j < n; ++j)
+            {
+                auto t = PackedDateTime(start + (i + j) * 999983);
+                pos += format.format(t, pos, format.length());
+                *pos++ = '\n';
+            }
+            std::fwrite(buffer.data(), 1, size_t(pos - buffer.data()), file);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <optional>
+#include <string_view>
+#include "Pipeline.hpp"
+
+namespace Utc2Gnss
+{
+    enum class TimeFormat
+    {
+        /* ISO 8601 UTC date and time. */
+        ISO,
+        /* Seconds since 1970-01-01 with an optional fraction. */
+        UNIX,
+        /* Microseconds since 1970-01-01. */
+        UNIX_US,
+        /* Modified Julian Date in UTC. */
+        MJD,
+        /* GPS week and time of week in seconds. */
+        GPS
+    };
+
+    std::optional<TimeFormat> parseTimeFormat(std::string_view name);
+
+    struct ConverterOptions
+    {
+        TimeFormat from = TimeFormat::ISO;
+        TimeFormat to = TimeFormat::GPS;
+        /* The input is 64-bit little-endian integers: seconds for UNIX,
+           microseconds for UNIX_US and microseconds since the GPS epoch
+           for GPS. */
+        bool binary = false;
+    };
+
+    /* Parses the records in chunk.input, converts them and writes the
+       results to chunk.output, one line per record. Records that can't
+       be parsed are written as "invalid". Empty lines are skipped. */
+    void convertChunk(Chunk& chunk, const ConverterOptions& options);
+
+    /* Writes count ISO 8601 timestamps around the leap second at the end
+       of 2016 to file. */
+    void generateInput(FILE* file, size_t count);
+}
@@ -0,0 +1,276 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Pipeline.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Utc2Gnss
+{
+    namespace
+    {
+        /* Returns the length of the longest prefix of data that only
+           contains complete records, or all of it if atEnd is true. */
+        size_t findRecordEnd(std::string_view data, RecordFormat format,
+                             bool atEnd)
+        {
+            if (format.binarySize != 0)
+                return data.size() - data.size() % format.binarySize;
+            if (atEnd)
+                return data.size();
+            auto pos = data.rfind('\n');
+            return pos == std::string_view::npos ? 0 : pos + 1;
+        }
+
+        class MappedFileSource : public Source
+        {
+        public:
+            MappedFileSource(const std::string& path, size_t chunkSize,
+                             RecordFormat format)
+                : m_ChunkSize(chunkSize),
+                  m_Format(format)
+            {
+                auto fd = ::open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                    throw std::runtime_error("Can not open " + path);
+                struct stat st = {};
+                if (::fstat(fd, &st) == -1)
+                {
+                    ::close(fd);
+                    throw std::runtime_error("Can not stat " + path);
+                }
+                m_Size = size_t(st.st_size);
+                if (m_Size != 0)
+                {
+                    auto addr = ::mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE,
+                                       fd, 0);
+                    if (addr == MAP_FAILED)
+                    {
+                        ::close(fd);
+                        throw std::runtime_error("Can not map " + path);
+                    }
+                    ::madvise(addr, m_Size, MADV_SEQUENTIAL);
+                    m_Data = static_cast<const char*>(addr);
+                }
+                ::close(fd);
+            }
+
+            ~MappedFileSource() override
+            {
+                if (m_Data)
+                    ::munmap(const_cast<char*>(m_Data), m_Size);
+            }
+
+            bool next(Chunk& chunk) override
+            {
+                if (m_Pos == m_Size)
+                    return false;
+                auto n = std::min(m_ChunkSize, m_Size - m_Pos);
+                std::string_view data(m_Data + m_Pos, n);
+                bool atEnd = m_Pos + n == m_Size;
+                auto end = findRecordEnd(data, m_Format, atEnd);
+                /* A line can be longer than a chunk. */
+                while (end == 0 && !atEnd)
+                {
+                    n = std::min(n * 2, m_Size - m_Pos);
+                    data = std::string_view(m_Data + m_Pos, n);
+                    atEnd = m_Pos + n == m_Size;
+                    end = findRecordEnd(data, m_Format, atEnd);
+                }
+                chunk.input = data.substr(0, end);
+                /* An incomplete binary record at the end is ignored. */
+                m_Pos = atEnd ? m_Size : m_Pos + end;
+                return true;
+            }
+        private:
+            const char* m_Data = nullptr;
+            size_t m_Size = 0;
+            size_t m_Pos = 0;
+            size_t m_ChunkSize;
+            RecordFormat m_Format;
+        };
+
+        class StreamSource : public Source
+        {
+        public:
+            StreamSource(FILE* file, size_t chunkSize, RecordFormat format)
+                : m_File(file),
+                  m_ChunkSize(chunkSize),
+                  m_Format(format)
+            {}
+
+            bool next(Chunk& chunk) override
+            {
+                auto& buffer = chunk.storage;
+                buffer.swap(m_Rest);
+                m_Rest.clear();
+                bool atEnd = false;
+                size_t end = 0;
+                while (end == 0 && !atEnd)
+                {
+                    auto size = buffer.size();
+                    buffer.resize(size + m_ChunkSize);
+                    auto n = std::fread(&buffer[size], 1, buffer.size() - size,
+                                        m_File);
+                    buffer.resize(size + n);
+                    atEnd = n == 0;
+                    end = findRecordEnd(buffer, m_Format, atEnd);
+                }
+                if (end == 0)
+                    return false;
+                if (!atEnd)
+                    m_Rest.assign(buffer, end);
+                buffer.resize(end);
+                chunk.input = buffer;
+                return true;
+            }
+        private:
+            FILE* m_File;
+            size_t m_ChunkSize;
+            RecordFormat m_Format;
+            std::string m_Rest;
+        };
+
+        /* The state shared by the worker threads and the writer. */
+        struct PipelineState
+        {
+            std::mutex mutex;
+            std::condition_variable chunkDone;
+            std::condition_variable chunkWritten;
+            std::map<size_t, Chunk> done;
+            size_t nextIndex = 0;
+            size_t nextToWrite = 0;
+            bool endOfInput = false;
+            std::exception_ptr error;
+        };
+
+        void runWorker(Source& source, const ConvertFunction& convert,
+                       PipelineState& state, size_t maxChunksInFlight)
+        {
+            try
+            {
+                while (true)
+                {
+                    Chunk chunk;
+                    size_t index;
+                    {
+                        std::unique_lock lock(state.mutex);
+                        state.chunkWritten.wait(lock, [&]
+                        {
+                            return state.nextIndex < state.nextToWrite + maxChunksInFlight
+                                   || state.endOfInput || state.error;
+                        });
+                        if (state.endOfInput || state.error)
+                            break;
+                        if (!source.next(chunk))
+                        {
+                            state.endOfInput = true;
+                            state.chunkDone.notify_all();
+                            break;
+                        }
+                        index = state.nextIndex++;
+                    }
+
+                    convert(chunk);
+
+                    std::lock_guard lock(state.mutex);
+                    state.done.emplace(index, std::move(chunk));
+                    state.chunkDone.notify_all();
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard lock(state.mutex);
+                if (!state.error)
+                    state.error = std::current_exception();
+                state.chunkDone.notify_all();
+                state.chunkWritten.notify_all();
+            }
+        }
+    }
+
+    std::unique_ptr<Source> openMappedFile(const std::string& path,
+                                           size_t chunkSize,
+                                           RecordFormat format)
+    {
+        return std::make_unique<MappedFileSource>(path, chunkSize, format);
+    }
+
+    std::unique_ptr<Source> openStream(FILE* file, size_t chunkSize,
+                                       RecordFormat format)
+    {
+        return std::make_unique<StreamSource>(file, chunkSize, format);
+    }
+
+    PipelineResult runPipeline(Source& source, const ConvertFunction& convert,
+                               FILE* output, const PipelineOptions& options)
+    {
+        PipelineState state;
+        auto maxInFlight = std::max<size_t>(options.maxChunksInFlight, 1);
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < std::max<size_t>(options.threads, 1); ++i)
+        {
+            workers.emplace_back(runWorker, std::ref(source), std::cref(convert),
+                                 std::ref(state), maxInFlight);
+        }
+
+        PipelineResult result;
+        while (true)
+        {
+            Chunk chunk;
+            {
+                std::unique_lock lock(state.mutex);
+                state.chunkDone.wait(lock, [&]
+                {
+                    return state.done.count(state.nextToWrite) != 0
+                           || state.error
+                           || (state.endOfInput
+                               && state.nextToWrite == state.nextIndex);
+                });
+                auto it = state.done.find(state.nextToWrite);
+                if (state.error || it == state.done.end())
+                    break;
+                chunk = std::move(it->second);
+                state.done.erase(it);
+            }
+
+            auto& out = chunk.output;
+            bool ok = std::fwrite(out.data(), 1, out.size(), output) == out.size();
+            result.rows += chunk.rows;
+            result.errors += chunk.errors;
+            result.inputBytes += chunk.input.size();
+            result.outputBytes += out.size();
+
+            std::lock_guard lock(state.mutex);
+            if (!ok && !state.error)
+            {
+                state.error = std::make_exception_ptr(
+                    std::runtime_error("Can not write the output."));
+            }
+            ++state.nextToWrite;
+            state.chunkWritten.notify_all();
+        }
+
+        for (auto& worker : workers)
+            worker.join();
+        if (state.error)
+            std::rethrow_exception(state.error);
+        return result;
+    }
+}
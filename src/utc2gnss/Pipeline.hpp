@@ -0,0 +1,79 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/* The input is split into chunks that end at a record boundary. Worker
+   threads convert the chunks in parallel, and the main thread writes
+   the results in input order. At most maxChunksInFlight chunks are read
+   but not yet written, which bounds the memory use. */
+
+namespace Utc2Gnss
+{
+    struct Chunk
+    {
+        /* The storage for chunks read from a stream, empty for chunks
+           that point into a memory mapped file. */
+        std::string storage;
+        std::string_view input;
+        std::string output;
+        size_t rows = 0;
+        size_t errors = 0;
+    };
+
+    class Source
+    {
+    public:
+        virtual ~Source() = default;
+
+        /* Sets chunk.input to the next chunk of at least one complete
+           record. Returns false at the end of the input. Only called by
+           one thread at a time. */
+        virtual bool next(Chunk& chunk) = 0;
+    };
+
+    /* Records are either lines or fixed-size binary values. */
+    struct RecordFormat
+    {
+        size_t binarySize = 0;
+    };
+
+    /* Throws std::runtime_error if the file can't be opened. */
+    std::unique_ptr<Source> openMappedFile(const std::string& path,
+                                           size_t chunkSize,
+                                           RecordFormat format);
+
+    std::unique_ptr<Source> openStream(FILE* file, size_t chunkSize,
+                                       RecordFormat format);
+
+    struct PipelineOptions
+    {
+        size_t threads = 1;
+        size_t maxChunksInFlight = 2;
+    };
+
+    struct PipelineResult
+    {
+        size_t rows = 0;
+        size_t errors = 0;
+        size_t inputBytes = 0;
+        size_t outputBytes = 0;
+    };
+
+    using ConvertFunction = std::function<void (Chunk&)>;
+
+    /* Converts every chunk from source with convert and writes the
+       output to output in input order. Throws std::runtime_error if
+       writing fails. */
+    PipelineResult runPipeline(Source& source, const ConvertFunction& convert,
+                               FILE* output, const PipelineOptions& options);
+}
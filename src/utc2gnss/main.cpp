@@ -0,0 +1,198 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <thread>
+#include "Converter.hpp"
+
+namespace
+{
+    constexpr const char USAGE[] =
+        "Usage: utc2gnss [options] [INPUT [OUTPUT]]\n"
+        "\n"
+        "Converts timestamps, one per line, between UTC and GPS time.\n"
+        "INPUT and OUTPUT default to stdin and stdout, \"-\" also means\n"
+        "stdin or stdout.\n"
+        "\n"
+        "Options:\n"
+        "  -f, --from FORMAT     The input format (default: iso).\n"
+        "  -t, --to FORMAT       The output format (default: gps).\n"
+        "                        FORMAT is iso, unix, unix-us, mjd or gps.\n"
+        "  -b, --binary          The input is 64-bit little-endian integers:\n"
+        "                        seconds (unix), microseconds (unix-us) or\n"
+        "                        microseconds since the GPS epoch (gps).\n"
+        "  -j, --threads N       The number of worker threads\n"
+        "                        (default: the number of cores).\n"
+        "  -c, --chunk-size MB   The size of each chunk of input (default: 4).\n"
+        "  -q, --quiet           Don't write statistics to stderr.\n"
+        "      --generate N      Write N ISO 8601 test timestamps to OUTPUT.\n"
+        "  -h, --help            Show this help.\n";
+
+    struct Arguments
+    {
+        Utc2Gnss::ConverterOptions converter;
+        size_t threads = 0;
+        size_t chunkSize = 4;
+        bool quiet = false;
+        size_t generate = 0;
+        std::string input = "-";
+        std::string output = "-";
+    };
+
+    [[noreturn]] void fail(const std::string& message)
+    {
+        std::fprintf(stderr, "utc2gnss: %s\n", message.c_str());
+        std::exit(1);
+    }
+
+    size_t parseCount(std::string_view option, const char* value)
+    {
+        char* end = nullptr;
+        auto n = std::strtoull(value, &end, 10);
+        if (end == value || *end != '\0')
+            fail("invalid value for " + std::string(option) + ": " + value);
+        return size_t(n);
+    }
+
+    Utc2Gnss::TimeFormat parseFormat(std::string_view option, const char* value)
+    {
+        auto format = Utc2Gnss::parseTimeFormat(value);
+        if (!format)
+            fail("invalid value for " + std::string(option) + ": " + value);
+        return *format;
+    }
+
+    Arguments parseArguments(int argc, char* argv[])
+    {
+        Arguments args;
+        int positional = 0;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string_view arg = argv[i];
+            auto nextValue = [&]
+            {
+                if (i + 1 == argc)
+                    fail(std::string(arg) + " requires a value");
+                return argv[++i];
+            };
+
+            if (arg == "-h" || arg == "--help")
+            {
+                std::fputs(USAGE, stdout);
+                std::exit(0);
+            }
+            else if (arg == "-f" || arg == "--from")
+                args.converter.from = parseFormat(arg, nextValue());
+            else if (arg == "-t" || arg == "--to")
+                args.converter.to = parseFormat(arg, nextValue());
+            else if (arg == "-b" || arg == "--binary")
+                args.converter.binary = true;
+            else if (arg == "-j" || arg == "--threads")
+                args.threads = parseCount(arg, nextValue());
+            else if (arg == "-c" || arg == "--chunk-size")
+                args.chunkSize = parseCount(arg, nextValue());
+            else if (arg == "-q" || arg == "--quiet")
+                args.quiet = true;
+            else if (arg == "--generate")
+                args.generate = parseCount(arg, nextValue());
+            else if (arg.size() > 1 && arg[0] == '-')
+                fail("unknown option: " + std::string(arg));
+            else if (positional == 0)
+                args.input = arg, ++positional;
+            else if (positional == 1)
+                args.output = arg, ++positional;
+            else
+                fail("too many arguments");
+        }
+
+        if (args.converter.binary && args.converter.from == Utc2Gnss::TimeFormat::ISO)
+            args.converter.from = Utc2Gnss::TimeFormat::UNIX_US;
+        if (args.converter.binary && args.converter.from == Utc2Gnss::TimeFormat::MJD)
+            fail("binary input must be unix, unix-us or gps");
+        if (args.threads == 0)
+            args.threads = std::max(std::thread::hardware_concurrency(), 1u);
+        if (args.chunkSize == 0)
+            fail("the chunk size must be at least 1 MB");
+        /* In --generate mode the only positional argument is the output. */
+        if (args.generate != 0 && positional == 1)
+            std::swap(args.input, args.output);
+        return args;
+    }
+
+    FILE* openOutput(const std::string& path)
+    {
+        if (path == "-")
+            return stdout;
+        auto file = std::fopen(path.c_str(), "wb");
+        if (!file)
+            fail("can not open " + path);
+        return file;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    auto args = parseArguments(argc, argv);
+    auto output = openOutput(args.output);
+    std::setvbuf(output, nullptr, _IOFBF, 1 << 20);
+
+    if (args.generate != 0)
+    {
+        Utc2Gnss::generateInput(output, args.generate);
+        return std::fclose(output) == 0 ? 0 : 1;
+    }
+
+    try
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        auto chunkSize = args.chunkSize << 20;
+        Utc2Gnss::RecordFormat recordFormat{args.converter.binary ? 8u : 0u};
+        auto source = args.input == "-"
+                      ? Utc2Gnss::openStream(stdin, chunkSize, recordFormat)
+                      : Utc2Gnss::openMappedFile(args.input, chunkSize,
+                                                 recordFormat);
+
+        Utc2Gnss::PipelineOptions options;
+        options.threads = args.threads;
+        options.maxChunksInFlight = 2 * args.threads;
+        auto converter = args.converter;
+        auto result = Utc2Gnss::runPipeline(
+            *source,
+            [&converter](Utc2Gnss::Chunk& chunk)
+            {
+                Utc2Gnss::convertChunk(chunk, converter);
+            },
+            output, options);
+
+        if (std::fclose(output) != 0)
+            fail("can not write the output");
+
+        if (!args.quiet)
+        {
+            std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+            auto secs = std::max(elapsed.count(), 1e-9);
+            std::fprintf(stderr,
+                         "%zu rows (%zu invalid) in %.3f s: %.0f rows/s, %.1f MB/s\n",
+                         result.rows, result.errors, secs,
+                         double(result.rows) / secs,
+                         double(result.inputBytes) / secs / 1e6);
+        }
+        return result.errors == 0 ? 0 : 2;
+    }
+    catch (std::exception& ex)
+    {
+        fail(ex.what());
+    }
+}
@@ -0,0 +1,74 @@
+# ===========================================================================
+# Copyright © 2026 Jan Erik Breimo. All rights reserved.
+# Created by Jan Erik Breimo on 2026-10-19.
+#
+# This file is distributed under the BSD License.
+# License text is included with the source distribution.
+# ===========================================================================
+# Runs utc2gnss end to end. The same input is converted by one thread and
+# by eight threads with small chunks, from a file and from stdin, and the
+# outputs must be identical. The GPS times are then converted back to
+# ISO 8601 and must match the input.
+#
+# Usage: cmake -DUTC2GNSS=<path> -DWORK_DIR=<dir> -P RunUtc2Gnss.cmake
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+function(run_utc2gnss)
+    cmake_parse_arguments(RUN "" "STDIN" "" ${ARGN})
+    if (RUN_STDIN)
+        set(input_file INPUT_FILE ${RUN_STDIN})
+    endif ()
+    execute_process(
+        COMMAND ${UTC2GNSS} -q ${RUN_UNPARSED_ARGUMENTS}
+        ${input_file}
+        RESULT_VARIABLE result
+        ERROR_VARIABLE error)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "utc2gnss ${RUN_UNPARSED_ARGUMENTS} failed: ${error}")
+    endif ()
+endfunction()
+
+function(require_same_files a b)
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -E compare_files ${a} ${b}
+        RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${a} and ${b} differ.")
+    endif ()
+endfunction()
+
+# About 5.6 MB, i.e. several chunks of 1 MB. The generated timestamps
+# start 2016-12-31 and cross the leap second at the end of that day.
+run_utc2gnss(--generate 200000 ${WORK_DIR}/input.txt)
+
+run_utc2gnss(-j 1 ${WORK_DIR}/input.txt ${WORK_DIR}/gps-1.txt)
+run_utc2gnss(-j 8 -c 1 ${WORK_DIR}/input.txt ${WORK_DIR}/gps-8.txt)
+run_utc2gnss(-j 8 -c 1 - ${WORK_DIR}/gps-stdin.txt
+             STDIN ${WORK_DIR}/input.txt)
+require_same_files(${WORK_DIR}/gps-1.txt ${WORK_DIR}/gps-8.txt)
+require_same_files(${WORK_DIR}/gps-1.txt ${WORK_DIR}/gps-stdin.txt)
+
+file(STRINGS ${WORK_DIR}/gps-1.txt lines LIMIT_COUNT 1)
+if (NOT lines MATCHES "^[0-9]+ [0-9]+\\.[0-9]+$")
+    message(FATAL_ERROR "Unexpected GPS output: ${lines}")
+endif ()
+
+run_utc2gnss(-f gps -t iso -j 4 ${WORK_DIR}/gps-1.txt
+             ${WORK_DIR}/roundtrip.txt)
+require_same_files(${WORK_DIR}/input.txt ${WORK_DIR}/roundtrip.txt)
+
+# Malformed lines are written as "invalid" and counted, they must not stop
+# the conversion. The exit code is 2 when there are invalid lines.
+file(WRITE ${WORK_DIR}/malformed.txt "2200 100.5\n2200 \n2200,\n2200 x\n")
+execute_process(
+    COMMAND ${UTC2GNSS} -q -f gps -t iso ${WORK_DIR}/malformed.txt
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE error)
+set(expected "2022-03-06T00:01:22.500000Z\ninvalid\ninvalid\ninvalid\n")
+if (NOT result EQUAL 2 OR NOT output STREQUAL expected)
+    message(FATAL_ERROR "Unexpected result for malformed GPS input: "
+                        "${result}\n${output}${error}")
+endif ()
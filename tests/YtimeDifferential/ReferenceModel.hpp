@@ -0,0 +1,316 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "Ytime/DateTime.hpp"
+#include "Ytime/DateTimeDelta.hpp"
+
+/* A deliberately simple model of the Gregorian calendar and the leap
+   second table. Nothing here shares code with the library: days are
+   counted by walking years and months, and the leap seconds are a plain
+   list of dates. It is only meant to be obviously correct. */
+
+namespace Reference
+{
+    using Ytime::Date;
+    using Ytime::DateTime;
+    using Ytime::DateTimeDelta;
+    using Ytime::Time;
+
+    constexpr int64_t SEC = 1000000;
+    constexpr int64_t DAY = 86400 * SEC;
+
+    constexpr int FIRST_YEAR = 1582;
+    constexpr int LAST_YEAR = 9999;
+
+    constexpr bool isLeapYear(int year)
+    {
+        return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    }
+
+    constexpr int daysInMonth(int year, int month)
+    {
+        switch (month)
+        {
+        case 2:
+            return isLeapYear(year) ? 29 : 28;
+        case 4: case 6: case 9: case 11:
+            return 30;
+        default:
+            return 31;
+        }
+    }
+
+    constexpr Date nextDay(Date date)
+    {
+        if (++date.day > daysInMonth(date.year, date.month))
+        {
+            date.day = 1;
+            if (++date.month > 12)
+            {
+                date.month = 1;
+                ++date.year;
+            }
+        }
+        return date;
+    }
+
+    /* Days since 1200-03-01, the library's epoch, counted one year and
+       one month at a time. 1200 is a leap year, January and February
+       have 60 days. */
+    constexpr int64_t countDays(Date date)
+    {
+        int64_t days = -60;
+        for (int y = 1200; y < date.year; ++y)
+            days += isLeapYear(y) ? 366 : 365;
+        for (int m = 1; m < date.month; ++m)
+            days += daysInMonth(date.year, m);
+        return days + date.day - 1;
+    }
+
+    /* The leap seconds announced by IERS, each inserted after 23:59:59
+       on the given date. */
+    constexpr Date LEAP_SECOND_DATES[] = {
+        {1972, 6, 30}, {1972, 12, 31}, {1973, 12, 31}, {1974, 12, 31},
+        {1975, 12, 31}, {1976, 12, 31}, {1977, 12, 31}, {1978, 12, 31},
+        {1979, 12, 31}, {1981, 6, 30}, {1982, 6, 30}, {1983, 6, 30},
+        {1985, 6, 30}, {1987, 12, 31}, {1989, 12, 31}, {1990, 12, 31},
+        {1992, 6, 30}, {1993, 6, 30}, {1994, 6, 30}, {1995, 12, 31},
+        {1997, 6, 30}, {1998, 12, 31}, {2005, 12, 31}, {2008, 12, 31},
+        {2012, 6, 30}, {2015, 6, 30}, {2016, 12, 31}
+    };
+
+    constexpr bool isBefore(const Date& a, const Date& b)
+    {
+        if (a.year != b.year)
+            return a.year < b.year;
+        if (a.month != b.month)
+            return a.month < b.month;
+        return a.day < b.day;
+    }
+
+    constexpr bool isSameDate(const Date& a, const Date& b)
+    {
+        return !isBefore(a, b) && !isBefore(b, a);
+    }
+
+    /* The number of leap seconds inserted before date. */
+    constexpr int leapSecondsBefore(const Date& date)
+    {
+        int n = 0;
+        for (auto& d : LEAP_SECOND_DATES)
+            n += isBefore(d, date) ? 1 : 0;
+        return n;
+    }
+
+    constexpr bool hasLeapSecond(const Date& date)
+    {
+        for (auto& d : LEAP_SECOND_DATES)
+        {
+            if (isSameDate(d, date))
+                return true;
+        }
+        return false;
+    }
+
+    constexpr int64_t usecsOfDay(const Time& t)
+    {
+        return ((t.hour * 60 + t.minute) * 60 + t.second) * SEC + t.usecond;
+    }
+
+    constexpr bool isValid(const DateTime& dt)
+    {
+        auto& d = dt.date;
+        auto& t = dt.time;
+        if (d.year < FIRST_YEAR || d.year > LAST_YEAR
+            || d.month < 1 || d.month > 12
+            || d.day < 1 || d.day > daysInMonth(d.year, d.month))
+        {
+            return false;
+        }
+        if (t.hour < 0 || t.hour > 23 || t.minute < 0 || t.minute > 59
+            || t.usecond < 0 || t.usecond >= SEC || t.second < 0)
+        {
+            return false;
+        }
+        if (t.second == 60)
+            return t.hour == 23 && t.minute == 59 && Reference::hasLeapSecond(d);
+        return t.second < 60;
+    }
+
+    /* The calendar, with the day number of every January 1st stored in
+       a table to keep random lookups fast. */
+    class Calendar
+    {
+    public:
+        Calendar()
+        {
+            auto days = countDays({FIRST_YEAR, 1, 1});
+            for (int y = FIRST_YEAR; y <= LAST_YEAR + 1; ++y)
+            {
+                m_YearStarts.push_back(days);
+                days += isLeapYear(y) ? 366 : 365;
+            }
+        }
+
+        int64_t toDays(const Date& date) const
+        {
+            auto days = m_YearStarts[size_t(date.year - FIRST_YEAR)];
+            for (int m = 1; m < date.month; ++m)
+                days += daysInMonth(date.year, m);
+            return days + date.day - 1;
+        }
+
+        Date toDate(int64_t days) const
+        {
+            auto it = std::upper_bound(m_YearStarts.begin(),
+                                       m_YearStarts.end(), days);
+            auto year = FIRST_YEAR + int(std::distance(m_YearStarts.begin(), it)) - 1;
+            days -= *(it - 1);
+            int month = 1;
+            while (days >= daysInMonth(year, month))
+                days -= daysInMonth(year, month++);
+            return {year, month, int(days) + 1};
+        }
+
+        /* The microseconds since the epoch including leap seconds, the
+           same quantity as PackedDateTime. */
+        int64_t pack(const DateTime& dt) const
+        {
+            return toDays(dt.date) * DAY + usecsOfDay(dt.time)
+                   + leapSecondsBefore(dt.date) * SEC;
+        }
+
+        DateTime unpack(int64_t value) const
+        {
+            for (auto& d : LEAP_SECOND_DATES)
+            {
+                auto start = pack({d, {23, 59, 59}}) + SEC;
+                if (start <= value && value < start + SEC)
+                    return {d, {23, 59, 60, int(value - start)}};
+            }
+            /* Count the leap seconds that ended at or before value. */
+            int n = 0;
+            for (auto& d : LEAP_SECOND_DATES)
+            {
+                if (pack({nextDay(d), {0, 0, 0}}) <= value)
+                    ++n;
+            }
+            value -= n * SEC;
+            auto date = toDate(value / DAY);
+            auto usecs = value % DAY;
+            Time t(int(usecs / (3600 * SEC)), int(usecs / (60 * SEC) % 60),
+                   int(usecs / SEC % 60), int(usecs % SEC));
+            return {date, t};
+        }
+
+        /* A leap second counts as the first second of the next day. */
+        int64_t toUnixUsecs(const DateTime& dt) const
+        {
+            return (toDays(dt.date) - toDays({1970, 1, 1})) * DAY
+                   + usecsOfDay(dt.time);
+        }
+
+        DateTime fromUnixUsecs(int64_t usecs) const
+        {
+            auto days = usecs / DAY - (usecs % DAY < 0 ? 1 : 0);
+            auto rest = usecs - days * DAY;
+            auto date = toDate(days + toDays({1970, 1, 1}));
+            Time t(int(rest / (3600 * SEC)), int(rest / (60 * SEC) % 60),
+                   int(rest / SEC % 60), int(rest % SEC));
+            return {date, t};
+        }
+
+        /* GPS time runs with TAI, it has counted every leap second since
+           1980-01-06. */
+        int64_t toGpsUsecs(const DateTime& dt) const
+        {
+            Date epoch(1980, 1, 6);
+            return (toDays(dt.date) - toDays(epoch)) * DAY
+                   + usecsOfDay(dt.time)
+                   + (leapSecondsBefore(dt.date) - leapSecondsBefore(epoch)) * SEC;
+        }
+
+        int64_t toModifiedJulianDay(const Date& date) const
+        {
+            return toDays(date) - toDays({1858, 11, 17});
+        }
+
+        /* Adds days on the calendar, keeping the time of day, then
+           elapsed microseconds. */
+        int64_t add(int64_t packed, int64_t days, int64_t usecs) const
+        {
+            auto dt = unpack(packed);
+            dt.date = toDate(toDays(dt.date) + days);
+            return pack(dt) + usecs;
+        }
+
+        /* The calendar days from one instant to another that don't go
+           past the second one, and the microseconds that remain. */
+        DateTimeDelta difference(int64_t from, int64_t to) const
+        {
+            auto days = toDays(unpack(to).date) - toDays(unpack(from).date);
+            auto usecs = to - add(from, days, 0);
+            if (days > 0 && usecs < 0)
+                usecs = to - add(from, --days, 0);
+            else if (days < 0 && usecs > 0)
+                usecs = to - add(from, ++days, 0);
+            return {days, usecs};
+        }
+
+        /* Parses "YYYY-MM-DDTHH:mm:SS.ffffff" followed by nothing, "Z"
+           or a UTC offset "+hh:mm", and returns -1 if it fails. */
+        int64_t parseIso(const std::string& text) const
+        {
+            DateTime dt;
+            auto& d = dt.date;
+            auto& t = dt.time;
+            int n = 0;
+            if (std::sscanf(text.c_str(), "%4d-%2d-%2dT%2d:%2d:%2d.%6d%n",
+                            &d.year, &d.month, &d.day, &t.hour, &t.minute,
+                            &t.second, &t.usecond, &n) != 7
+                || n != 26 || !Reference::isValid(dt))
+            {
+                return -1;
+            }
+
+            auto suffix = text.substr(size_t(n));
+            int offset = 0;
+            if (suffix.size() == 6)
+            {
+                char sign = 0;
+                int hours = 0, minutes = 0;
+                if (std::sscanf(suffix.c_str(), "%c%2d:%2d", &sign,
+                                &hours, &minutes) != 3
+                    || (sign != '+' && sign != '-'))
+                {
+                    return -1;
+                }
+                offset = (hours * 60 + minutes) * (sign == '-' ? -1 : 1);
+            }
+            else if (!suffix.empty() && suffix != "Z")
+            {
+                return -1;
+            }
+
+            /* Only the hours and minutes are moved by the offset. */
+            auto minutes = toDays(d) * 1440 + t.hour * 60 + t.minute - offset;
+            d = toDate(minutes / 1440);
+            t.hour = int(minutes % 1440 / 60);
+            t.minute = int(minutes % 60);
+            return pack(dt);
+        }
+    private:
+        std::vector<int64_t> m_YearStarts;
+    };
+}
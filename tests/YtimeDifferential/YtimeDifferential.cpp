@@ -0,0 +1,578 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Ytime/AstronomicalTime.hpp"
+#include "Ytime/DateTimeFormat.hpp"
+#include "Ytime/GpsTime.hpp"
+#include "Ytime/LeapSeconds.hpp"
+#include "Ytime/TimestampParser.hpp"
+#include "Ytime/TimestampScanner.hpp"
+#include "Ytime/UnixTime.hpp"
+#include "Ytime/Detail/InternalDateTimeMath.hpp"
+#include "ReferenceModel.hpp"
+
+/* Compares the library's optimized paths with the reference model in
+   ReferenceModel.hpp and reports mismatches and the relative speed of
+   the two. Every date in the supported range is checked exhaustively,
+   instants, deltas and strings are checked with random samples that
+   are biased towards leap seconds. Exits with 1 if anything differs. */
+
+namespace
+{
+    using namespace Ytime;
+    using Reference::DAY;
+    using Reference::SEC;
+
+    /* The constexpr paths are compared at compile time over one
+       400-year cycle. */
+    constexpr bool checkConstexprCycle()
+    {
+        Date date(2000, 3, 1);
+        auto expected = Reference::countDays(date);
+        auto yearStart = expected;
+        for (; date.year < 2400 || date.month < 3; ++expected)
+        {
+            if (date.month == 3 && date.day == 1)
+                yearStart = expected;
+            if (int64_t(Detail::daysSinceEpochYMD(date)) != expected)
+                return false;
+            /* Internally years start on March 1st. */
+            auto [year, dayOfYear] = Detail::toInternalYD(uint32_t(expected));
+            if (int(year) != (date.month > 2 ? date.year : date.year - 1)
+                || int64_t(dayOfYear) != expected - yearStart)
+            {
+                return false;
+            }
+            date = Reference::nextDay(date);
+        }
+        return true;
+    }
+
+    static_assert(checkConstexprCycle());
+
+    constexpr DateTimeFormat ISO_FORMAT("YYYY-MM-DDTHH:mm:SS.ffffff");
+
+    constexpr bool checkConstexprParse()
+    {
+        auto dt = ISO_FORMAT.parseFields("2016-12-31T23:59:60.999999");
+        return dt && dt->date.year == 2016 && dt->date.month == 12
+               && dt->date.day == 31 && dt->time.hour == 23
+               && dt->time.minute == 59 && dt->time.second == 60
+               && dt->time.usecond == 999999;
+    }
+
+    static_assert(checkConstexprParse());
+
+    struct Result
+    {
+        std::string name;
+        size_t count = 0;
+        size_t mismatches = 0;
+        double optimizedNsecs = 0;
+        double referenceNsecs = 0;
+    };
+
+    std::vector<Result> g_Results;
+
+    template <typename Function>
+    double measureNsecs(Function function)
+    {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        std::chrono::duration<double, std::nano> elapsed
+            = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    std::ostream& operator<<(std::ostream& os, const DayFraction& value)
+    {
+        return os << value.day << " + " << value.fraction;
+    }
+
+    template <typename T>
+    std::string toString(const T& value)
+    {
+        std::ostringstream ss;
+        ss << value;
+        return ss.str();
+    }
+
+    /* Runs optimized and reference over all inputs, each filling an
+       output vector, and compares the outputs. */
+    template <typename Out, typename In, typename Optimized,
+              typename Ref, typename Equal = std::equal_to<Out>>
+    void compare(const std::string& name, const std::vector<In>& inputs,
+                 Optimized optimized, Ref reference, Equal equal = {})
+    {
+        std::vector<Out> actual(inputs.size()), expected(inputs.size());
+        Result result;
+        result.name = name;
+        result.count = inputs.size();
+        result.optimizedNsecs = measureNsecs([&] {optimized(inputs, actual);});
+        result.referenceNsecs = measureNsecs([&] {reference(inputs, expected);});
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            if (equal(actual[i], expected[i]))
+                continue;
+            if (++result.mismatches <= 5)
+            {
+                std::printf("MISMATCH %s: input %s: got %s, expected %s\n",
+                            name.c_str(), toString(inputs[i]).c_str(),
+                            toString(actual[i]).c_str(),
+                            toString(expected[i]).c_str());
+            }
+        }
+        g_Results.push_back(result);
+    }
+
+    template <typename In, typename Out, typename Function>
+    auto forEach(Function function)
+    {
+        return [function](const std::vector<In>& in, std::vector<Out>& out)
+        {
+            for (size_t i = 0; i < in.size(); ++i)
+                out[i] = function(in[i]);
+        };
+    }
+
+    std::string formatIso(const DateTime& dt, std::string_view suffix = {})
+    {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "%04d-%02d-%02dT%02d:%02d:%02d.%06d",
+                      dt.date.year, dt.date.month, dt.date.day,
+                      dt.time.hour, dt.time.minute, dt.time.second,
+                      dt.time.usecond);
+        return buf + std::string(suffix);
+    }
+
+    /* Generates valid instants in the supported range. One in eight is
+       within a few seconds of a leap second, one in sixteen is in a
+       leap second. */
+    class InstantGenerator
+    {
+    public:
+        InstantGenerator(const Reference::Calendar& calendar, uint64_t seed)
+            : m_Calendar(calendar),
+              m_Random(seed)
+        {}
+
+        DateTime next(int firstYear = Reference::FIRST_YEAR,
+                      int lastYear = Reference::LAST_YEAR)
+        {
+            auto kind = random(0, 15);
+            if (kind == 0)
+            {
+                auto& d = pickLeapDate();
+                return {d, {23, 59, 60, int(random(0, SEC - 1))}};
+            }
+            if (kind <= 2)
+            {
+                auto& d = pickLeapDate();
+                auto p = m_Calendar.pack({d, {23, 59, 59}})
+                         + random(-2 * SEC, 3 * SEC);
+                return m_Calendar.unpack(p);
+            }
+            auto first = m_Calendar.toDays({firstYear, 1, 1});
+            auto last = m_Calendar.toDays({lastYear, 12, 31});
+            auto date = m_Calendar.toDate(random(first, last));
+            auto usecs = random(0, DAY - 1);
+            return {date, {int(usecs / (3600 * SEC)),
+                           int(usecs / (60 * SEC) % 60),
+                           int(usecs / SEC % 60), int(usecs % SEC)}};
+        }
+
+        int64_t random(int64_t min, int64_t max)
+        {
+            return std::uniform_int_distribution<int64_t>(min, max)(m_Random);
+        }
+    private:
+        const Date& pickLeapDate()
+        {
+            constexpr auto n = std::size(Reference::LEAP_SECOND_DATES);
+            return Reference::LEAP_SECOND_DATES[random(0, int64_t(n) - 1)];
+        }
+
+        const Reference::Calendar& m_Calendar;
+        std::mt19937_64 m_Random;
+    };
+
+    void checkDates(const Reference::Calendar& calendar)
+    {
+        /* The inputs are made by stepping one day at a time, the
+           reference results come from the calendar's table. */
+        std::vector<Date> dates;
+        std::vector<uint32_t> days;
+        Date date(Reference::FIRST_YEAR, 1, 1);
+        auto day = Reference::countDays(date);
+        for (; date.year <= Reference::LAST_YEAR; ++day)
+        {
+            dates.push_back(date);
+            days.push_back(uint32_t(day));
+            date = Reference::nextDay(date);
+        }
+        auto saturday = calendar.toDays({2000, 1, 1});
+
+        compare<uint32_t>(
+            "daysSinceEpochYMD (every date)", dates,
+            forEach<Date, uint32_t>([](auto& d)
+                                    {return Detail::daysSinceEpochYMD(d);}),
+            forEach<Date, uint32_t>([&](auto& d)
+                                    {return uint32_t(calendar.toDays(d));}));
+        compare<Date>(
+            "toYMD (every date)", days,
+            forEach<uint32_t, Date>([](auto n) {return Detail::toYMD(n);}),
+            forEach<uint32_t, Date>([&](auto n)
+                                    {return calendar.toDate(n);}));
+        compare<int>(
+            "getWeekday (every date)", dates,
+            forEach<Date, int>([](auto& d) {return getWeekday(d);}),
+            [&](auto& in, auto& out)
+            {
+                /* 2000-01-01 was a Saturday. */
+                for (size_t i = 0; i < in.size(); ++i)
+                    out[i] = int(((int64_t(days[i]) - saturday) % 7 + 12) % 7) + 1;
+            });
+        compare<bool>(
+            "hasLeapSecond (every date)", dates,
+            forEach<Date, bool>([](auto& d) {return hasLeapSecond(d);}),
+            forEach<Date, bool>([](auto& d)
+                                {return Reference::hasLeapSecond(d);}));
+        compare<int64_t>(
+            "pack midnight (every date)", dates,
+            forEach<Date, int64_t>([](auto& d)
+                                   {return int64_t(pack({d, {0, 0, 0}}));}),
+            forEach<Date, int64_t>([&](auto& d)
+                                   {return calendar.pack({d, {0, 0, 0}});}));
+    }
+
+    void checkInstants(const Reference::Calendar& calendar,
+                       InstantGenerator& generator, size_t samples)
+    {
+        std::vector<DateTime> instants(samples);
+        std::vector<int64_t> packed(samples);
+        for (size_t i = 0; i < samples; ++i)
+        {
+            instants[i] = generator.next();
+            packed[i] = calendar.pack(instants[i]);
+        }
+
+        compare<int64_t>(
+            "pack", instants,
+            forEach<DateTime, int64_t>([](auto& dt) {return int64_t(pack(dt));}),
+            forEach<DateTime, int64_t>([&](auto& dt) {return calendar.pack(dt);}));
+        compare<DateTime>(
+            "unpack", packed,
+            forEach<int64_t, DateTime>([](auto p)
+                                       {return unpack(PackedDateTime(p));}),
+            forEach<int64_t, DateTime>([&](auto p) {return calendar.unpack(p);}));
+        compare<int64_t>(
+            "toUnixTimeUsecs (scalar)", packed,
+            forEach<int64_t, int64_t>([](auto p)
+                                      {return toUnixTimeUsecs(PackedDateTime(p));}),
+            forEach<int64_t, int64_t>([&](auto p)
+                                      {return calendar.toUnixUsecs(calendar.unpack(p));}));
+        compare<int64_t>(
+            "toUnixTimeUsecs (batch)", packed,
+            [](auto& in, auto& out)
+            {
+                toUnixTimeUsecs(reinterpret_cast<const PackedDateTime*>(in.data()),
+                                in.size(), out.data());
+            },
+            forEach<int64_t, int64_t>([&](auto p)
+                                      {return calendar.toUnixUsecs(calendar.unpack(p));}));
+        compare<int64_t>(
+            "toGpsTimeUsecs (batch)", packed,
+            [](auto& in, auto& out)
+            {
+                toGpsTimeUsecs(reinterpret_cast<const PackedDateTime*>(in.data()),
+                               in.size(), out.data());
+            },
+            forEach<int64_t, int64_t>([&](auto p)
+                                      {return calendar.toGpsUsecs(calendar.unpack(p));}));
+        compare<DayFraction>(
+            "toModifiedJulianDay (batch)", packed,
+            [](auto& in, auto& out)
+            {
+                toModifiedJulianDay(reinterpret_cast<const PackedDateTime*>(in.data()),
+                                    in.size(), out.data());
+            },
+            forEach<int64_t, DayFraction>([&](auto p)
+            {
+                auto dt = calendar.unpack(p);
+                auto length = Reference::hasLeapSecond(dt.date) ? DAY + SEC : DAY;
+                return DayFraction{calendar.toModifiedJulianDay(dt.date),
+                                   double(Reference::usecsOfDay(dt.time))
+                                   / double(length)};
+            }),
+            [](auto& a, auto& b)
+            {
+                return a.day == b.day && std::abs(a.fraction - b.fraction) < 1e-12;
+            });
+
+        std::vector<int64_t> unixUsecs(samples);
+        auto first = calendar.toUnixUsecs({{Reference::FIRST_YEAR, 1, 1}, {}});
+        auto last = calendar.toUnixUsecs({{Reference::LAST_YEAR, 12, 31}, {}});
+        for (auto& u : unixUsecs)
+            u = generator.random(first, last);
+        compare<int64_t>(
+            "fromUnixTimeUsecs (batch)", unixUsecs,
+            [](auto& in, auto& out)
+            {
+                fromUnixTimeUsecs(in.data(), in.size(),
+                                  reinterpret_cast<PackedDateTime*>(out.data()));
+            },
+            forEach<int64_t, int64_t>([&](auto u)
+                                      {return calendar.pack(calendar.fromUnixUsecs(u));}));
+
+        compare<std::string>(
+            "DateTimeFormat::format", packed,
+            forEach<int64_t, std::string>([](auto p)
+                                          {return ISO_FORMAT.format(PackedDateTime(p));}),
+            forEach<int64_t, std::string>([&](auto p)
+                                          {return formatIso(calendar.unpack(p));}));
+    }
+
+    struct DeltaInput
+    {
+        int64_t from;
+        int64_t days;
+        int64_t usecs;
+        int64_t to;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const DeltaInput& d)
+    {
+        return os << d.from << " + (" << d.days << " days, " << d.usecs
+                  << " us)";
+    }
+
+    void checkDeltas(const Reference::Calendar& calendar,
+                     InstantGenerator& generator, size_t samples)
+    {
+        std::vector<DeltaInput> inputs(samples);
+        for (auto& input : inputs)
+        {
+            auto from = generator.next(1700, 9800);
+            /* Days can't be counted from a leap second. */
+            if (from.time.second == 60)
+                from.time.second = 59;
+            input.from = calendar.pack(from);
+            input.days = generator.random(-36500, 36500);
+            input.usecs = generator.random(-2 * DAY, 2 * DAY);
+            input.to = calendar.pack(generator.next(1700, 9800));
+        }
+
+        compare<int64_t>(
+            "add", inputs,
+            forEach<DeltaInput, int64_t>([](auto& d)
+            {
+                return int64_t(add(PackedDateTime(d.from),
+                                   DateTimeDelta(d.days, d.usecs)));
+            }),
+            forEach<DeltaInput, int64_t>([&](auto& d)
+                                         {return calendar.add(d.from, d.days, d.usecs);}));
+        compare<DateTimeDelta>(
+            "getDateTimeDelta", inputs,
+            forEach<DeltaInput, DateTimeDelta>([](auto& d)
+            {
+                return getDateTimeDelta(PackedDateTime(d.from),
+                                        PackedDateTime(d.to));
+            }),
+            forEach<DeltaInput, DateTimeDelta>([&](auto& d)
+                                               {return calendar.difference(d.from, d.to);}));
+    }
+
+    struct ParseInput
+    {
+        std::string text;
+        std::string embedded;
+        DateTime utc;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const ParseInput& p)
+    {
+        return os << '"' << p.text << '"';
+    }
+
+    void checkParsers(const Reference::Calendar& calendar,
+                      InstantGenerator& generator, size_t samples)
+    {
+        std::vector<ParseInput> inputs(samples);
+        for (auto& input : inputs)
+        {
+            input.utc = generator.next(1600, 9900);
+            auto& dt = input.utc;
+            if (dt.time.second == 60 || generator.random(0, 1) == 0)
+            {
+                input.text = formatIso(dt, generator.random(0, 1) ? "Z" : "");
+            }
+            else
+            {
+                /* Write the local time at a random UTC offset. Only
+                   hours and minutes are shifted. */
+                auto offset = int(generator.random(-14 * 60, 14 * 60));
+                auto minutes = calendar.toDays(dt.date) * 1440
+                               + dt.time.hour * 60 + dt.time.minute + offset;
+                DateTime local(calendar.toDate(minutes / 1440),
+                               {int(minutes % 1440 / 60), int(minutes % 60),
+                                dt.time.second, dt.time.usecond});
+                /* Large enough for any int, to keep -Wformat-truncation
+                   quiet. */
+                char suffix[32];
+                std::snprintf(suffix, sizeof(suffix), "%c%02d:%02d",
+                              offset < 0 ? '-' : '+',
+                              std::abs(offset) / 60, std::abs(offset) % 60);
+                input.text = formatIso(local, suffix);
+            }
+            input.embedded = "INFO [" + input.text + "] id=1-22-333 done";
+        }
+
+        /* The reference model parses the strings with sscanf. */
+        auto expectedPacked = forEach<ParseInput, int64_t>(
+            [&](auto& p) {return calendar.parseIso(p.text);});
+        auto extractAndParse = forEach<ParseInput, int64_t>([&](auto& p)
+        {
+            auto start = p.embedded.find('[') + 1;
+            auto end = p.embedded.find(']', start);
+            return calendar.parseIso(p.embedded.substr(start, end - start));
+        });
+        auto toInt = [](const std::optional<PackedDateTime>& p)
+        {
+            return p ? int64_t(*p) : int64_t(-1);
+        };
+
+        compare<int64_t>(
+            "parseDateTime", inputs,
+            forEach<ParseInput, int64_t>([&](auto& p)
+            {
+                auto dt = parseDateTime(p.text);
+                return dt ? int64_t(pack(*dt)) : int64_t(-1);
+            }),
+            expectedPacked);
+        compare<int64_t>(
+            "findTimestamp", inputs,
+            forEach<ParseInput, int64_t>([&](auto& p)
+            {
+                auto match = findTimestamp(p.embedded);
+                return match ? int64_t(match->dateTime) : int64_t(-1);
+            }),
+            extractAndParse);
+
+        /* DateTimeFormat and TimestampParser don't accept UTC offsets. */
+        std::vector<ParseInput> plain;
+        for (auto& input : inputs)
+        {
+            if (input.text.size() == ISO_FORMAT.length())
+                plain.push_back(input);
+        }
+        std::string_view sample;
+        if (!plain.empty())
+            sample = plain[0].text;
+        auto parser = detectTimestampParser(&sample, plain.empty() ? 0 : 1);
+        compare<int64_t>(
+            "DateTimeFormat::parse", plain,
+            forEach<ParseInput, int64_t>([&](auto& p)
+                                         {return toInt(ISO_FORMAT.parse(p.text));}),
+            expectedPacked);
+        compare<int64_t>(
+            "TimestampParser::parse", plain,
+            forEach<ParseInput, int64_t>([&](auto& p)
+                                         {return toInt(parser.parse(p.text));}),
+            expectedPacked);
+    }
+
+    void checkValidation(InstantGenerator& generator, size_t samples)
+    {
+        std::vector<DateTime> inputs(samples);
+        for (auto& dt : inputs)
+        {
+            auto leapDate = Reference::LEAP_SECOND_DATES[generator.random(0, 26)];
+            dt.date = generator.random(0, 3) == 0
+                      ? leapDate
+                      : Date(int(generator.random(1570, 9999)),
+                             int(generator.random(0, 13)),
+                             int(generator.random(0, 32)));
+            dt.time = Time(int(generator.random(-1, 24)),
+                           int(generator.random(-1, 60)),
+                           int(generator.random(55, 61)),
+                           int(generator.random(-1, SEC)));
+        }
+        compare<bool>(
+            "isValid", inputs,
+            forEach<DateTime, bool>([](auto& dt) {return isValid(dt);}),
+            forEach<DateTime, bool>([](auto& dt) {return Reference::isValid(dt);}));
+    }
+
+    void printResults()
+    {
+        std::printf("\n%-34s %10s %10s %12s %12s %9s\n", "Check", "Values",
+                    "Mismatches", "Ytime ns", "Reference ns", "Speed-up");
+        std::printf("%-34s %10s %10s %12s %12s %9s\n",
+                    "constexpr days (2000-2400)", "146097", "0",
+                    "compile", "compile", "-");
+        for (auto& r : g_Results)
+        {
+            auto n = double(std::max<size_t>(r.count, 1));
+            std::printf("%-34s %10zu %10zu %12.1f %12.1f %8.1fx\n",
+                        r.name.c_str(), r.count, r.mismatches,
+                        r.optimizedNsecs / n, r.referenceNsecs / n,
+                        r.referenceNsecs / std::max(r.optimizedNsecs, 1.0));
+        }
+    }
+
+    [[noreturn]] void usage()
+    {
+        std::fputs("Usage: YtimeDifferential [--samples N] [--seed N]\n",
+                   stderr);
+        std::exit(2);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    size_t samples = 200000;
+    uint64_t seed = std::random_device()();
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        if (i + 1 == argc)
+            usage();
+        if (arg == "--samples")
+            samples = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--seed")
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else
+            usage();
+    }
+    std::printf("Seed: %llu\n", static_cast<unsigned long long>(seed));
+
+    Reference::Calendar calendar;
+    InstantGenerator generator(calendar, seed);
+    checkDates(calendar);
+    checkInstants(calendar, generator, samples);
+    checkDeltas(calendar, generator, samples);
+    checkParsers(calendar, generator, samples);
+    checkValidation(generator, samples);
+    printResults();
+
+    for (auto& r : g_Results)
+    {
+        if (r.mismatches != 0)
+            return 1;
+    }
+    return 0;
+}
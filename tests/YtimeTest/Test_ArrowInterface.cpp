@@ -0,0 +1,155 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/ArrowInterface.hpp"
+#include <cstring>
+#include <limits>
+#include "Ytime/UnixTime.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    std::vector<PackedDateTime> makeTimestamps()
+    {
+        std::vector<PackedDateTime> result;
+        auto t = pack({{2016, 12, 31}, {23, 0, 0}});
+        for (int64_t i = 0; i < 1000; ++i)
+            result.push_back(PackedDateTime(t + i * 7000001));
+        return result;
+    }
+}
+
+TEST_CASE("Export and import timestamps")
+{
+    auto values = makeTimestamps();
+    ArrowArray array;
+    ArrowSchema schema;
+    exportTimestamps(values.data(), values.size(), &array, &schema);
+    REQUIRE(std::strcmp(schema.format, "tsu:UTC") == 0);
+    REQUIRE(array.length == 1000);
+    REQUIRE(array.n_buffers == 2);
+    REQUIRE(array.buffers[0] == nullptr);
+
+    auto usecs = static_cast<const int64_t*>(array.buffers[1]);
+    for (size_t i = 0; i < values.size(); ++i)
+        REQUIRE(usecs[i] == toUnixTimeUsecs(values[i]));
+
+    std::vector<PackedDateTime> imported(values.size());
+    importTimestamps(&array, &schema, imported.data());
+    for (size_t i = 0; i < values.size(); ++i)
+        REQUIRE(imported[i] == fromUnixTimeUsecs(usecs[i]));
+
+    array.release(&array);
+    schema.release(&schema);
+    REQUIRE(array.release == nullptr);
+    REQUIRE(schema.release == nullptr);
+}
+
+TEST_CASE("Export timestamps without copying")
+{
+    auto values = makeTimestamps();
+    auto expected = values;
+    auto buffer = values.data();
+    ArrowArray array;
+    ArrowSchema schema;
+    exportTimestamps(std::move(values), &array, &schema);
+    REQUIRE(array.buffers[1] == buffer);
+    auto usecs = static_cast<const int64_t*>(array.buffers[1]);
+    for (size_t i = 0; i < expected.size(); ++i)
+        REQUIRE(usecs[i] == toUnixTimeUsecs(expected[i]));
+    array.release(&array);
+    schema.release(&schema);
+}
+
+TEST_CASE("Import timestamps with other units, offset and nulls")
+{
+    int64_t values[] = {-1, 1483228800, 0, 1483228801};
+    uint8_t validity[] = {0x0B};
+    const void* buffers[] = {validity, values};
+    ArrowArray array = {};
+    array.length = 3;
+    array.null_count = 1;
+    array.offset = 1;
+    array.n_buffers = 2;
+    array.buffers = buffers;
+    array.release = [](ArrowArray* a) {a->release = nullptr;};
+    ArrowSchema schema = {};
+
+    PackedDateTime result[3];
+    auto nullValue = PackedDateTime(1);
+    schema.format = "tss:";
+    importTimestamps(&array, &schema, result, nullValue);
+    REQUIRE(result[0] == pack({{2017, 1, 1}, {0, 0, 0}}));
+    REQUIRE(result[1] == nullValue);
+    REQUIRE(result[2] == pack({{2017, 1, 1}, {0, 0, 1}}));
+
+    schema.format = "tsm:Europe/Oslo";
+    importTimestamps(&array, &schema, result, nullValue);
+    REQUIRE(result[0] == pack({{1970, 1, 18}, {4, 0, 28, 800000}}));
+
+    schema.format = "tdD";
+    REQUIRE_THROWS(importTimestamps(&array, &schema, result));
+}
+
+TEST_CASE("Import timestamps with extreme values")
+{
+    constexpr auto MAX = std::numeric_limits<int64_t>::max();
+    constexpr auto MIN = std::numeric_limits<int64_t>::min();
+    int64_t values[] = {MAX, 1483228800, MIN, MAX};
+    uint8_t validity[] = {0x02};
+    const void* buffers[] = {validity, values};
+    ArrowArray array = {};
+    array.length = 4;
+    array.null_count = 3;
+    array.n_buffers = 2;
+    array.buffers = buffers;
+    array.release = [](ArrowArray* a) {a->release = nullptr;};
+    ArrowSchema schema = {};
+
+    auto nullValue = PackedDateTime(1);
+    for (auto format : {"tss:", "tsm:", "tsu:", "tsn:"})
+    {
+        CAPTURE(format);
+        PackedDateTime result[4];
+        schema.format = format;
+        importTimestamps(&array, &schema, result, nullValue);
+        REQUIRE(result[0] == nullValue);
+        REQUIRE(result[2] == nullValue);
+        REQUIRE(result[3] == nullValue);
+    }
+
+    /* Valid values outside the range of PackedDateTime are clamped. */
+    array.null_count = 0;
+    schema.format = "tss:";
+    PackedDateTime result[4];
+    importTimestamps(&array, &schema, result, nullValue);
+    REQUIRE(result[1] == pack({{2017, 1, 1}, {0, 0, 0}}));
+    REQUIRE(result[2] == PackedDateTime(0));
+    REQUIRE(result[3] > result[1]);
+}
+
+TEST_CASE("Export and import dates")
+{
+    std::vector<Date> dates = {{1970, 1, 1}, {1969, 12, 31}, {2024, 2, 29},
+                               {1600, 3, 1}};
+    ArrowArray array;
+    ArrowSchema schema;
+    exportDates(dates.data(), dates.size(), &array, &schema);
+    REQUIRE(std::strcmp(schema.format, "tdD") == 0);
+    auto days = static_cast<const int32_t*>(array.buffers[1]);
+    REQUIRE(days[0] == 0);
+    REQUIRE(days[1] == -1);
+    REQUIRE(days[2] == 19782);
+
+    std::vector<Date> imported(dates.size());
+    importDates(&array, &schema, imported.data());
+    REQUIRE(imported == dates);
+    array.release(&array);
+    schema.release(&schema);
+}
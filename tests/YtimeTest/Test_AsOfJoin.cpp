@@ -0,0 +1,70 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/AsOfJoin.hpp"
+#include <vector>
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    PackedDateTime at(int second)
+    {
+        return PackedDateTime(pack({{2024, 3, 1}, {12, 0, 0}})
+                              + second * USECS_PER_SEC);
+    }
+
+    constexpr auto NONE = ASOF_NO_MATCH;
+}
+
+TEST_CASE("asOfJoin directions")
+{
+    PackedDateTime left[] = {at(0), at(5), at(10), at(12), at(30)};
+    PackedDateTime right[] = {at(1), at(5), at(5), at(9), at(20)};
+    size_t result[5];
+
+    asOfJoin(left, 5, right, 5, result, AsOfDirection::BACKWARD);
+    REQUIRE(std::vector<size_t>(result, result + 5)
+            == std::vector<size_t>{NONE, 2, 3, 3, 4});
+
+    asOfJoin(left, 5, right, 5, result, AsOfDirection::FORWARD);
+    REQUIRE(std::vector<size_t>(result, result + 5)
+            == std::vector<size_t>{0, 1, 4, 4, NONE});
+
+    asOfJoin(left, 5, right, 5, result, AsOfDirection::NEAREST);
+    REQUIRE(std::vector<size_t>(result, result + 5)
+            == std::vector<size_t>{0, 2, 3, 3, 4});
+
+    asOfJoin(left, 5, right, 5, result, AsOfDirection::NEAREST, Seconds(2));
+    REQUIRE(std::vector<size_t>(result, result + 5)
+            == std::vector<size_t>{0, 2, 3, NONE, NONE});
+
+    REQUIRE_THROWS_AS(asOfJoin(left, 5, right, 5, result,
+                               AsOfDirection::NEAREST, Seconds(-1)),
+                      YtimeException);
+}
+
+TEST_CASE("asOfJoinParallel matches asOfJoin")
+{
+    std::vector<PackedDateTime> left, right;
+    for (int i = 0; i < 300000; ++i)
+        left.push_back(at(i * 3));
+    for (int i = 0; i < 100000; ++i)
+        right.push_back(at(i * 7 + (i % 5)));
+
+    for (auto direction : {AsOfDirection::BACKWARD, AsOfDirection::FORWARD,
+                           AsOfDirection::NEAREST})
+    {
+        std::vector<size_t> expected(left.size()), result(left.size());
+        asOfJoin(left.data(), left.size(), right.data(), right.size(),
+                 expected.data(), direction, Seconds(4));
+        asOfJoinParallel(left.data(), left.size(), right.data(), right.size(),
+                         result.data(), direction, Seconds(4), 4);
+        REQUIRE(result == expected);
+    }
+}
@@ -0,0 +1,117 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/AstronomicalTime.hpp"
+#include <vector>
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    void checkDayFraction(const DayFraction& value, int64_t day,
+                          double fraction)
+    {
+        REQUIRE(value.day == day);
+        REQUIRE(value.fraction == Approx(fraction).margin(1e-12));
+    }
+}
+
+TEST_CASE("Julian Date and MJD at known epochs")
+{
+    checkDayFraction(toModifiedJulianDay(pack({{2000, 1, 1}, {0, 0, 0}})),
+                     51544, 0);
+    checkDayFraction(toJulianDay(pack({{2000, 1, 1}, {12, 0, 0}})),
+                     2451545, 0);
+    checkDayFraction(toJulianDay(pack({{2000, 1, 1}, {0, 0, 0}})),
+                     2451544, 0.5);
+    checkDayFraction(toModifiedJulianDay(pack({{1858, 11, 17}, {6, 0, 0}})),
+                     0, 0.25);
+    REQUIRE(toJulianDate(pack({{2000, 1, 1}, {18, 0, 0}}))
+            == Approx(2451545.25).margin(1e-9));
+    REQUIRE(toModifiedJulianDate(pack({{1200, 3, 1}, {0, 0, 0}}))
+            == -240590);
+}
+
+TEST_CASE("TAI and TT")
+{
+    /* J2000.0 is 2000-01-01 12:00 TT. */
+    auto j2000 = pack({{2000, 1, 1}, {11, 58, 55, 816000}});
+    checkDayFraction(toJulianDay(j2000, TimeScale::TT), 2451545, 0);
+    REQUIRE(fromJulianDay({2451545, 0}, TimeScale::TT) == j2000);
+
+    auto t = pack({{2017, 6, 1}, {0, 0, 0}});
+    REQUIRE(getTaiOffsetUsecs(t) == 37000000);
+    checkDayFraction(toModifiedJulianDay(t, TimeScale::TAI),
+                     57905, 37.0 / 86400);
+    checkDayFraction(toModifiedJulianDay(t, TimeScale::TT),
+                     57905, 69.184 / 86400);
+}
+
+TEST_CASE("MJD on a day with a leap second")
+{
+    auto leap = pack({{2016, 12, 31}, {23, 59, 60}});
+    checkDayFraction(toModifiedJulianDay(leap), 57753, 86400.0 / 86401);
+    checkDayFraction(toModifiedJulianDay(PackedDateTime(leap + 1000000)),
+                     57754, 0);
+    REQUIRE(fromModifiedJulianDay({57753, 86400.0 / 86401}) == leap);
+    REQUIRE(fromModifiedJulianDay({57753, 1.0}) == leap + 1000000);
+    /* TAI days have no leap seconds. */
+    auto tai = toModifiedJulianDay(leap, TimeScale::TAI);
+    checkDayFraction(tai, 57754, 36.0 / 86400);
+}
+
+TEST_CASE("Astronomical round trips")
+{
+    auto start = pack({{1960, 1, 1}, {0, 0, 0}});
+    for (auto scale : {TimeScale::UTC, TimeScale::TAI, TimeScale::TT})
+    {
+        for (int64_t i = 0; i < 20000; ++i)
+        {
+            auto t = PackedDateTime(start + i * 99991234567LL + i % 1000);
+            auto mjd = toModifiedJulianDay(t, scale);
+            REQUIRE(fromModifiedJulianDay(mjd, scale) == t);
+            auto jd = toJulianDay(t, scale);
+            REQUIRE(fromJulianDay(jd, scale) == t);
+            auto d = int64_t(fromModifiedJulianDate(
+                toModifiedJulianDate(t, scale), scale)) - int64_t(t);
+            REQUIRE(std::abs(d) <= 2);
+        }
+    }
+}
+
+TEST_CASE("Batch astronomical conversions match scalar")
+{
+    std::vector<PackedDateTime> values;
+    auto t = pack({{2016, 12, 30}, {0, 0, 0}});
+    for (int64_t i = 0; i < 3000; ++i)
+        values.push_back(PackedDateTime(t + i * 97000000 + 17));
+    auto far = pack({{1950, 1, 1}, {0, 0, 0}});
+    for (int64_t i = 0; i < 1000; ++i)
+        values.push_back(PackedDateTime(far + i * 1000000007LL));
+
+    std::vector<DayFraction> days(values.size());
+    std::vector<double> dates(values.size());
+    std::vector<double> jds(values.size());
+    std::vector<PackedDateTime> back(values.size());
+    for (auto scale : {TimeScale::UTC, TimeScale::TAI, TimeScale::TT})
+    {
+        toModifiedJulianDay(values.data(), values.size(), days.data(), scale);
+        toModifiedJulianDate(values.data(), values.size(), dates.data(), scale);
+        toJulianDate(values.data(), values.size(), jds.data(), scale);
+        fromModifiedJulianDate(dates.data(), dates.size(), back.data(), scale);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            auto mjd = toModifiedJulianDay(values[i], scale);
+            REQUIRE(days[i].day == mjd.day);
+            REQUIRE(days[i].fraction == mjd.fraction);
+            REQUIRE(dates[i] == toModifiedJulianDate(values[i], scale));
+            REQUIRE(jds[i] == toJulianDate(values[i], scale));
+            REQUIRE(back[i] == fromModifiedJulianDate(dates[i], scale));
+        }
+    }
+}
@@ -0,0 +1,102 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/BusinessCalendar.hpp"
+#include "Ytime/PackedDateTime.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    BusinessCalendar makeCalendar2024()
+    {
+        return BusinessCalendar({2024, 1, 1}, {2024, 12, 31},
+                                {{2024, 1, 1}, {2024, 12, 25}});
+    }
+
+    Date nextDay(const Date& date)
+    {
+        return toYearMonthDay(DateYD(date.year, toYearDay(date).day + 1));
+    }
+}
+
+TEST_CASE("Weekdays")
+{
+    REQUIRE(getWeekday(Date(2024, 5, 1)) == 3);
+    REQUIRE(getWeekday(Date(1582, 10, 15)) == 5);
+    REQUIRE(getWeekday(pack({{2016, 12, 31}, {23, 59, 60}})) == 6);
+    REQUIRE(getWeekday(pack({{2017, 1, 1}, {0, 0, 0}})) == 7);
+}
+
+TEST_CASE("ISO week dates")
+{
+    auto check = [](Date date, DateYWD expected)
+    {
+        CAPTURE(date);
+        auto ywd = toYearWeekDay(date);
+        REQUIRE(ywd.year == expected.year);
+        REQUIRE(ywd.week == expected.week);
+        REQUIRE(ywd.weekday == expected.weekday);
+        REQUIRE(toYearMonthDay(ywd) == date);
+    };
+    check({2021, 1, 3}, {2020, 53, 7});
+    check({2024, 12, 30}, {2025, 1, 1});
+    check({2008, 12, 29}, {2009, 1, 1});
+    check({2010, 1, 3}, {2009, 53, 7});
+    check({2024, 5, 1}, {2024, 18, 3});
+}
+
+TEST_CASE("Business days between")
+{
+    auto calendar = makeCalendar2024();
+    REQUIRE(calendar.businessDaysBetween({2024, 1, 1}, {2025, 1, 1}) == 260);
+    REQUIRE(calendar.businessDaysBetween({2024, 5, 3}, {2024, 5, 6}) == 1);
+    REQUIRE(calendar.businessDaysBetween({2024, 5, 6}, {2024, 5, 3}) == -1);
+    REQUIRE(!calendar.isBusinessDay({2024, 12, 25}));
+    REQUIRE_THROWS_AS(calendar.businessDaysBetween({2023, 12, 31},
+                                                   {2024, 5, 3}),
+                      YtimeException);
+}
+
+TEST_CASE("Add business days")
+{
+    auto calendar = makeCalendar2024();
+    REQUIRE(calendar.addBusinessDays({2024, 5, 3}, 1) == Date(2024, 5, 6));
+    REQUIRE(calendar.addBusinessDays({2024, 5, 4}, -1) == Date(2024, 5, 3));
+    REQUIRE(calendar.addBusinessDays({2024, 5, 4}, 1) == Date(2024, 5, 6));
+    REQUIRE(calendar.addBusinessDays({2024, 12, 24}, 1) == Date(2024, 12, 26));
+    REQUIRE(calendar.addBusinessDays({2024, 1, 2}, 259) == Date(2024, 12, 31));
+    REQUIRE_THROWS_AS(calendar.addBusinessDays({2024, 1, 2}, 260),
+                      YtimeException);
+    REQUIRE_THROWS_AS(calendar.addBusinessDays({2024, 1, 2}, -1),
+                      YtimeException);
+}
+
+TEST_CASE("Business days match day by day counting")
+{
+    auto calendar = makeCalendar2024();
+    calendar.addHoliday({2024, 5, 17});
+    Date from(2024, 3, 9);
+    int64_t expected = 0;
+    for (Date to = from; to < Date(2024, 12, 31); to = nextDay(to))
+    {
+        REQUIRE(calendar.businessDaysBetween(from, to) == expected);
+        if (calendar.isBusinessDay(to))
+        {
+            ++expected;
+            REQUIRE(calendar.addBusinessDays(from, expected) == to);
+        }
+    }
+
+    Date dates[] = {{2024, 5, 3}, {2024, 5, 4}, {2024, 5, 16}};
+    Date result[3];
+    calendar.addBusinessDays(dates, 3, 1, result);
+    REQUIRE(result[0] == Date(2024, 5, 6));
+    REQUIRE(result[1] == Date(2024, 5, 6));
+    REQUIRE(result[2] == Date(2024, 5, 20));
+}
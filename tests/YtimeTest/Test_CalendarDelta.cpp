@@ -0,0 +1,62 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/CalendarDelta.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("addMonths with month end policies")
+{
+    REQUIRE(addMonths({2024, 1, 31}, 1) == Date(2024, 2, 29));
+    REQUIRE(addMonths({2023, 1, 31}, 1) == Date(2023, 2, 28));
+    REQUIRE(addMonths({2024, 1, 31}, 1, MonthEndPolicy::ROLL_OVER)
+            == Date(2024, 3, 2));
+    REQUIRE(addMonths({2024, 2, 29}, 1) == Date(2024, 3, 29));
+    REQUIRE(addMonths({2024, 2, 29}, 1, MonthEndPolicy::END_OF_MONTH)
+            == Date(2024, 3, 31));
+    REQUIRE(addMonths({2024, 2, 29}, 12) == Date(2025, 2, 28));
+    REQUIRE(addMonths({2024, 3, 15}, -3) == Date(2023, 12, 15));
+    REQUIRE(addMonths({2024, 12, 31}, -10) == Date(2024, 2, 29));
+    REQUIRE(addMonths({2000, 1, 1}, 12 * 400 + 1) == Date(2400, 2, 1));
+}
+
+TEST_CASE("Add CalendarDelta to PackedDateTime")
+{
+    auto t = pack({{2016, 11, 30}, {23, 59, 59}});
+    REQUIRE(unpack(add(t, Months(1))) == DateTime({2016, 12, 30}, {23, 59, 59}));
+    REQUIRE(unpack(add(t, Months(1) + Days(1) + Seconds(1)))
+            == DateTime({2016, 12, 31}, {23, 59, 60}));
+    REQUIRE(unpack(add(t, Years(-1))) == DateTime({2015, 11, 30}, {23, 59, 59}));
+    REQUIRE_THROWS_AS(add(pack({{2016, 12, 31}, {23, 59, 60}}), Months(1)),
+                      YtimeException);
+}
+
+TEST_CASE("getCalendarDelta")
+{
+    auto from = pack({{2024, 1, 31}, {12, 0, 0}});
+    REQUIRE(getCalendarDelta(from, pack({{2024, 2, 29}, {12, 0, 0}}))
+            == Months(1));
+    REQUIRE(getCalendarDelta(from, pack({{2024, 2, 29}, {11, 0, 0}}))
+            == CalendarDelta(0, Days(28) + Seconds(23 * 3600)));
+    REQUIRE(getCalendarDelta(from, pack({{2025, 3, 1}, {12, 0, 1}}))
+            == CalendarDelta(13, Days(1) + Seconds(1)));
+    REQUIRE(getCalendarDelta(from, pack({{2023, 12, 31}, {12, 0, 0}}))
+            == Months(-1));
+    REQUIRE(getCalendarDelta(from, pack({{2023, 12, 30}, {12, 0, 0}}))
+            == CalendarDelta(-1, Days(-1)));
+}
+
+TEST_CASE("makeSchedule doesn't drift after short months")
+{
+    PackedDateTime schedule[4];
+    makeSchedule(pack({{2024, 1, 31}, {9, 0, 0}}), Months(1), 4, schedule);
+    REQUIRE(unpackDate(schedule[0]) == Date(2024, 1, 31));
+    REQUIRE(unpackDate(schedule[1]) == Date(2024, 2, 29));
+    REQUIRE(unpackDate(schedule[2]) == Date(2024, 3, 31));
+    REQUIRE(unpackDate(schedule[3]) == Date(2024, 4, 30));
+}
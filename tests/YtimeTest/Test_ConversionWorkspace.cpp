@@ -0,0 +1,75 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/ConversionWorkspace.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("ConversionWorkspace grows to the high-water mark")
+{
+    ConversionWorkspace workspace;
+    REQUIRE(workspace.capacity() == 0);
+    auto a = workspace.allocate<char>(3);
+    auto b = workspace.allocate<int64_t>(4);
+    REQUIRE(a.size() == 3);
+    REQUIRE(reinterpret_cast<uintptr_t>(b.data()) % alignof(int64_t) == 0);
+    REQUIRE(workspace.size() >= 35);
+
+    workspace.reset();
+    auto capacity = workspace.capacity();
+    REQUIRE(capacity >= 35);
+    REQUIRE(workspace.size() == 0);
+
+    auto c = workspace.allocate<DateTime>(2);
+    REQUIRE(c[1] == DateTime());
+    workspace.reset();
+    REQUIRE(workspace.capacity() == capacity);
+}
+
+TEST_CASE("Moved-from ConversionWorkspace is empty")
+{
+    ConversionWorkspace a(1024);
+    a.allocate<int>(4);
+    ConversionWorkspace b(std::move(a));
+    REQUIRE(b.capacity() == 1024);
+    REQUIRE(b.size() == 4 * sizeof(int));
+    REQUIRE(a.capacity() == 0);
+    REQUIRE(a.size() == 0);
+    a.allocate<int>(4)[0] = 1;
+
+    ConversionWorkspace c;
+    c = std::move(b);
+    REQUIRE(c.capacity() == 1024);
+    REQUIRE(b.capacity() == 0);
+    REQUIRE(b.size() == 0);
+    b.allocate<int>(4)[3] = 1;
+    b.reset();
+    REQUIRE(b.capacity() >= 4 * sizeof(int));
+}
+
+TEST_CASE("Split, parse and format with a workspace")
+{
+    ConversionWorkspace workspace;
+    auto lines = splitLines("2024-03-05\r\n\nx\n2024-03-06", workspace);
+    REQUIRE(lines.size() == 4);
+    REQUIRE(lines[0] == "2024-03-05");
+    REQUIRE(lines[1].empty());
+    REQUIRE(lines[3] == "2024-03-06");
+
+    auto parser = detectTimestampParser(lines.data(), lines.size());
+    auto times = parseTimestamps(lines.data(), lines.size(), parser,
+                                 PackedDateTime(), workspace);
+    REQUIRE(times[0] == pack({{2024, 3, 5}, {0, 0, 0}}));
+    REQUIRE(times[1] == PackedDateTime());
+    REQUIRE(times[2] == PackedDateTime());
+    REQUIRE(times[3] == pack({{2024, 3, 6}, {0, 0, 0}}));
+
+    constexpr DateTimeFormat format("DD.MM.YYYY");
+    REQUIRE(formatTimestamps(times.data() + 3, 1, format, '\n', workspace)
+            == "06.03.2024\n");
+}
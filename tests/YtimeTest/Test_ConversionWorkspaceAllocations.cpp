@@ -0,0 +1,103 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/ConversionWorkspace.hpp"
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "Ytime/TimeZone.hpp"
+#include <catch2/catch.hpp>
+
+/* Replaces the global operator new to count allocations. This is in its
+   own test executable, YtimeAllocationTest, so the other tests don't
+   run with the replaced allocator. */
+
+using namespace Ytime;
+
+namespace
+{
+    thread_local size_t g_Allocations = 0;
+}
+
+void* operator new(size_t size)
+{
+    ++g_Allocations;
+    if (auto ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    std::string makeRequest(int count)
+    {
+        std::string text;
+        for (int i = 0; i < count; ++i)
+        {
+            text += "2024-03-";
+            text += std::to_string(10 + i % 20);
+            text += "T12:00:00\r\n";
+        }
+        text += "garbage\n";
+        return text;
+    }
+
+    /* Converts the request to local time in UTC+1 and formats it. */
+    std::string_view handleRequest(std::string_view request,
+                                   const TimeZone& tz,
+                                   ConversionWorkspace& workspace)
+    {
+        constexpr DateTimeFormat FORMAT("YYYY-MM-DD HH:mm");
+        workspace.reset();
+        auto lines = splitLines(request, workspace);
+        auto parser = detectTimestampParser(lines.data(), lines.size());
+        auto times = parseTimestamps(lines.data(), lines.size(), parser,
+                                     PackedDateTime(), workspace);
+        auto local = workspace.allocate<DateTime>(times.size());
+        tz.toLocal(times.data(), times.size(), local.data());
+        auto packed = workspace.allocate<PackedDateTime>(local.size());
+        for (size_t i = 0; i < local.size(); ++i)
+            packed[i] = pack(local[i]);
+        return formatTimestamps(packed.data(), packed.size(), FORMAT, ';',
+                                workspace);
+    }
+}
+
+TEST_CASE("Steady-state requests don't allocate")
+{
+    TimeZone tz("UTC+1", {}, {60 * 60});
+    auto large = makeRequest(1000);
+    auto small = makeRequest(10);
+    ConversionWorkspace workspace;
+
+    std::string expected(handleRequest(small, tz, workspace));
+    REQUIRE(expected.substr(0, 17) == "2024-03-10 13:00;");
+    /* The first large request overflows the block, and the block is
+       grown when the second request resets the workspace. */
+    handleRequest(large, tz, workspace);
+    handleRequest(large, tz, workspace);
+
+    g_Allocations = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        handleRequest(large, tz, workspace);
+        handleRequest(small, tz, workspace);
+    }
+    auto allocations = g_Allocations;
+    REQUIRE(allocations == 0);
+    REQUIRE(handleRequest(small, tz, workspace) == expected);
+}
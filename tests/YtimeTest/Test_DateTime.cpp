@@ -16,3 +16,69 @@ TEST_CASE("Test parseTime")
     REQUIRE(t);
     REQUIRE(*t == Time(13, 12, 10, 678000));
 }
+
+TEST_CASE("Test parseDateTime with UTC offset")
+{
+    using namespace Ytime;
+    auto dt = parseDateTime("2024-05-01T12:00:00.123+02:00");
+    REQUIRE(dt);
+    REQUIRE(*dt == DateTime({2024, 5, 1}, {10, 0, 0, 123000}));
+
+    dt = parseDateTime("2024-05-01T12:00:00Z");
+    REQUIRE(dt);
+    REQUIRE(*dt == DateTime({2024, 5, 1}, {12, 0, 0}));
+
+    REQUIRE(!parseDateTime("2024-05-01T12:00:00+2:00"));
+    REQUIRE(!parseDateTime("2024-05-01T12:00:00+24:00"));
+    REQUIRE(!parseDateTime("2024-05-01T12:00:00Z+01:00"));
+}
+
+TEST_CASE("Test parseDateTime with UTC offset and invalid local time")
+{
+    using namespace Ytime;
+    /* Without an offset the fields are returned as they are, and
+       validate rejects them. */
+    auto dt = parseDateTime("2024-05-01T25:00:00Z");
+    REQUIRE((!dt || !validate(*dt).empty()));
+    REQUIRE(!parseDateTime("2024-05-01T25:00:00+01:00"));
+    REQUIRE(!parseDateTime("2024-05-01T23:75:00+00:30"));
+    REQUIRE(!parseDateTime("2024-05-01T12:00:61+01:00"));
+    REQUIRE(!parseDateTimeAndOffset("2024-05-01T24:00:00-01:00"));
+}
+
+TEST_CASE("Test parseDateTime with Z followed by digits")
+{
+    using namespace Ytime;
+    REQUIRE(!parseDateTime("2024-01-01T00:00:00Z12"));
+    REQUIRE(!parseDateTime("2024-01-01T00:00:00Z1230"));
+    REQUIRE(!parseDateTime("2024-01-01T00:00:00Z12:30"));
+    REQUIRE(!parseDateTimeAndOffset("2024-01-01T00:00:00z12:30"));
+    REQUIRE(parseDateTime("2024-01-01T00:00:00z"));
+}
+
+TEST_CASE("Test parseDateTime with UTC offset across day boundaries")
+{
+    using namespace Ytime;
+    auto dt = parseDateTime("2024-03-01T01:30:00+02:00");
+    REQUIRE(dt);
+    REQUIRE(*dt == DateTime({2024, 2, 29}, {23, 30, 0}));
+
+    dt = parseDateTime("2023-12-31T22:15:00-05:30");
+    REQUIRE(dt);
+    REQUIRE(*dt == DateTime({2024, 1, 1}, {3, 45, 0}));
+}
+
+TEST_CASE("Test parseDateTimeAndOffset with leap second")
+{
+    using namespace Ytime;
+    auto result = parseDateTimeAndOffset("2017-01-01T00:59:60+01:00");
+    REQUIRE(result);
+    REQUIRE(result->first == DateTime({2016, 12, 31}, {23, 59, 60}));
+    REQUIRE(result->second == 60);
+    REQUIRE(validate(result->first).empty());
+
+    result = parseDateTimeAndOffset("1990-12-31T15:59:60-08:00");
+    REQUIRE(result);
+    REQUIRE(result->first == DateTime({1990, 12, 31}, {23, 59, 60}));
+    REQUIRE(result->second == -480);
+}
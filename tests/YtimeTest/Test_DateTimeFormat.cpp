@@ -0,0 +1,134 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/DateTimeFormat.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("DateTimeFormat is compiled at compile time")
+{
+    constexpr DateTimeFormat format("YYYYMMDDHHMMSS.fff");
+    static_assert(format.length() == 18);
+    constexpr auto dt = format.parseFields("20240501123456.789");
+    static_assert(dt && dt->date.year == 2024 && dt->date.day == 1);
+    static_assert(dt && dt->time.minute == 34 && dt->time.usecond == 789000);
+}
+
+TEST_CASE("DateTimeFormat parse DD/MM/YYYY HH:MM:SS")
+{
+    DateTimeFormat format("DD/MM/YYYY HH:MM:SS");
+    auto t = format.parse("31/12/2016 23:59:60");
+    REQUIRE(t);
+    REQUIRE(unpack(*t) == DateTime({2016, 12, 31}, {23, 59, 60}));
+    REQUIRE(!format.parse("31/12/2017 23:59:60"));
+    REQUIRE(!format.parse("31/11/2016 23:59:59"));
+    REQUIRE(!format.parse("31/12/2016 23:59:5"));
+    REQUIRE(!format.parse("31-12-2016 23:59:59"));
+}
+
+TEST_CASE("DateTimeFormat parse day of year")
+{
+    DateTimeFormat format("YYYY-DDD");
+    auto t = format.parse("2020-366");
+    REQUIRE(t);
+    REQUIRE(unpackDate(*t) == Date(2020, 12, 31));
+    REQUIRE(!format.parse("2021-366"));
+    REQUIRE(format.format(*t) == "2020-366");
+    REQUIRE(!format.parseDateTime("1000-100"));
+    REQUIRE(!format.parseDateTime("0000-001"));
+    REQUIRE(!format.parseDateTime("1581-365"));
+    REQUIRE(format.parseDateTime("1582-001"));
+}
+
+TEST_CASE("DateTimeFormat format")
+{
+    DateTimeFormat format("YYYY-MM-DD\\THH:mm:SS.ffffff");
+    auto t = pack({{2015, 6, 30}, {23, 59, 60, 12345}});
+    REQUIRE(format.format(t) == "2015-06-30T23:59:60.012345");
+
+    char buffer[8];
+    REQUIRE(format.format(t, buffer, sizeof(buffer)) == 0);
+}
+
+TEST_CASE("DateTimeFormat format with a year after 9999")
+{
+    DateTimeFormat format("YYYY-MM-DD");
+    char buffer[16];
+    REQUIRE(format.format(DateTime({12345, 1, 2}, {}), buffer,
+                          sizeof(buffer)) == 0);
+    REQUIRE_THROWS_AS(format.format(pack({{12345, 1, 2}, {}})),
+                      YtimeException);
+    REQUIRE(format.format(pack({{9999, 12, 31}, {}})) == "9999-12-31");
+}
+
+namespace
+{
+    constexpr DateTimeFormat ISO_FORMAT("YYYY-MM-DDTHH:mm:SS.fff");
+    constexpr DateTimeFormat DAY_OF_YEAR_FORMAT("YYYY-DDD\\THH");
+    constexpr DateTimeFormat TIME_FORMAT("HH:mm:SS");
+}
+
+TEST_CASE("StaticDateTimeFormat is evaluated at compile time")
+{
+    using Iso = StaticDateTimeFormat<ISO_FORMAT>;
+    static_assert(Iso::length() == 23);
+    constexpr auto dt = Iso::parseFields("2024-05-01T12:34:56.789");
+    static_assert(dt && dt->date.month == 5 && dt->time.usecond == 789000);
+    static_assert(!Iso::parseFields("2024-05-01 12:34:56.789"));
+    static_assert(!Iso::parseFields("2024-05-01T12:34:56.78x"));
+}
+
+TEST_CASE("StaticDateTimeFormat matches DateTimeFormat")
+{
+    using Iso = StaticDateTimeFormat<ISO_FORMAT>;
+    using DayOfYear = StaticDateTimeFormat<DAY_OF_YEAR_FORMAT>;
+    using TimeOnly = StaticDateTimeFormat<TIME_FORMAT>;
+
+    for (auto str : {"2016-12-31T23:59:60.500", "2017-12-31T23:59:60.500",
+                     "2024-02-30T00:00:00.000", "2024-02-29T00:00:00.000",
+                     "2024-02-29T00:00:00.00", "2024-02-29X00:00:00.000"})
+    {
+        CAPTURE(str);
+        REQUIRE(Iso::parse(str) == ISO_FORMAT.parse(str));
+        REQUIRE(Iso::parseDateTime(str) == ISO_FORMAT.parseDateTime(str));
+    }
+    for (auto str : {"2020-366T12", "2021-366T12", "1581-001T00"})
+    {
+        CAPTURE(str);
+        REQUIRE(DayOfYear::parse(str) == DAY_OF_YEAR_FORMAT.parse(str));
+    }
+    REQUIRE(TimeOnly::parseDateTime("23:59:60")
+            == DateTime({}, {23, 59, 60}));
+    REQUIRE(!TimeOnly::parse("23:59:60"));
+
+    for (auto dt : {DateTime({2020, 12, 31}, {23, 59, 60, 123456}),
+                    DateTime({10000, 1, 1}, {0, 0, 0})})
+    {
+        CAPTURE(dt.date.year);
+        char expected[32] = {}, actual[32] = {};
+        auto n = ISO_FORMAT.format(dt, expected, sizeof(expected));
+        REQUIRE(Iso::format(dt, actual, sizeof(actual)) == n);
+        REQUIRE(std::string_view(actual, n) == std::string_view(expected, n));
+        n = DAY_OF_YEAR_FORMAT.format(dt, expected, sizeof(expected));
+        REQUIRE(DayOfYear::format(dt, actual, sizeof(actual)) == n);
+        REQUIRE(std::string_view(actual, n) == std::string_view(expected, n));
+    }
+
+    char buffer[23];
+    auto t = pack({{2024, 3, 5}, {1, 2, 3, 4000}});
+    REQUIRE(Iso::format(t, buffer, 22) == 0);
+    REQUIRE(Iso::format(t, buffer, 23) == 23);
+    REQUIRE(std::string_view(buffer, 23) == "2024-03-05T01:02:03.004");
+}
+
+TEST_CASE("DateTimeFormat rejects invalid patterns")
+{
+    REQUIRE_THROWS_AS(DateTimeFormat("YY-MM-DD"), YtimeException);
+    REQUIRE_THROWS_AS(DateTimeFormat("YYYY-M-DD"), YtimeException);
+    REQUIRE_THROWS_AS(DateTimeFormat("HH:mm:SS.fffffff"), YtimeException);
+}
@@ -0,0 +1,39 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/DateTimeHash.hpp"
+#include <unordered_set>
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("Hash of equal values")
+{
+    static_assert(hashValue(Date(2024, 3, 5)) == hashValue(Date(2024, 3, 5)));
+    REQUIRE(std::hash<Date>()({2024, 3, 5}) != std::hash<Date>()({2024, 5, 3}));
+    REQUIRE(std::hash<Time>()({12, 0, 1}) != std::hash<Time>()({12, 1, 0}));
+    DateTime a({2016, 12, 31}, {23, 59, 60});
+    DateTime b({2016, 12, 31}, {23, 59, 60, 1});
+    REQUIRE(std::hash<DateTime>()(a) == std::hash<DateTime>()(a));
+    REQUIRE(std::hash<DateTime>()(a) != std::hash<DateTime>()(b));
+    REQUIRE(std::hash<PackedDateTime>()(pack(a)) == hashValue(pack(a)));
+}
+
+TEST_CASE("Hash of consecutive timestamps")
+{
+    /* Every input bit must reach the low bits that select the bucket. */
+    std::unordered_set<uint64_t> buckets;
+    auto start = pack({{2024, 3, 5}, {0, 0, 0}});
+    for (int64_t i = 0; i < 4096; ++i)
+        buckets.insert(hashValue(PackedDateTime(start + i * USECS_PER_SEC)) & 0xFFF);
+    REQUIRE(buckets.size() > 2400);
+
+    std::unordered_set<DateTime> dateTimes;
+    for (int i = 0; i < 1000; ++i)
+        dateTimes.insert(DateTime({2024, 3, 1 + i % 10}, {12, 0, 0, i % 100}));
+    REQUIRE(dateTimes.size() == 100);
+}
@@ -0,0 +1,83 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/Duration.hpp"
+#include <string>
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    std::string toString(const DateTimeDelta& delta)
+    {
+        char buffer[MAX_DURATION_LENGTH];
+        return {buffer, toChars(delta, buffer, sizeof(buffer))};
+    }
+
+    constexpr auto RETENTION = parseDuration("P2W3DT12H");
+    static_assert(RETENTION
+                  && *RETENTION == Days(17) + Seconds(12 * 3600));
+    static_assert(*parseDuration("PT0.25S") == Useconds(250000));
+}
+
+TEST_CASE("Parse durations")
+{
+    REQUIRE(parseDuration("P3DT4H30M") == Days(3) + Seconds(4 * 3600 + 1800));
+    REQUIRE(parseDuration("PT0.25S") == Useconds(250000));
+    REQUIRE(parseDuration("PT0,5S") == Useconds(500000));
+    REQUIRE(parseDuration("P1W") == Days(7));
+    REQUIRE(parseDuration("PT36H") == Seconds(36 * 3600));
+    REQUIRE(parseDuration("P0D") == DateTimeDelta());
+    REQUIRE(parseDuration("-P1DT1S") == -(Days(1) + Seconds(1)));
+    REQUIRE(parseDuration("+PT1M") == Seconds(60));
+    REQUIRE(parseDuration("PT1.5H") == Seconds(5400));
+    REQUIRE(parseDuration("P0.5D") == Seconds(43200));
+    REQUIRE(parseDuration("P1DT-5S") == Days(1) - Seconds(5));
+    REQUIRE(parseDuration("PT0.123456789S") == Useconds(123456));
+    REQUIRE(parseDuration("PT9223372036854.775807S")
+            == Useconds(INT64_MAX));
+}
+
+TEST_CASE("Parse invalid durations")
+{
+    for (auto str : {"", "P", "PT", "P1DT", "1D", "P1Y", "P1M", "PT1D",
+                     "P1H", "PT1S1M", "P1D1D", "PT1.5M1S", "PT.5S",
+                     "PT1.S", "PT1.1234567890S", "PT1", "P1DTT1H",
+                     "PT1 S", "PT9223372036855S", "P99999999999999999999D",
+                     "P-D", "--P1D"})
+    {
+        CAPTURE(str);
+        REQUIRE(!parseDuration(str));
+    }
+}
+
+TEST_CASE("Format durations")
+{
+    REQUIRE(toString({}) == "PT0S");
+    REQUIRE(toString(Days(3) + Seconds(4 * 3600 + 1800)) == "P3DT4H30M");
+    REQUIRE(toString(Useconds(250000)) == "PT0.25S");
+    REQUIRE(toString(Days(2)) == "P2D");
+    REQUIRE(toString(Useconds(3723000001)) == "PT1H2M3.000001S");
+    REQUIRE(toString(-(Days(1) + Seconds(90))) == "-P1DT1M30S");
+    REQUIRE(toString(Days(1) - Seconds(3661)) == "P1DT-1H-1M-1S");
+    REQUIRE(toString(Days(INT64_MIN) + Useconds(INT64_MIN)).size()
+            <= MAX_DURATION_LENGTH);
+
+    char small[4];
+    REQUIRE(toChars(Days(12345), small, sizeof(small)) == 0);
+}
+
+TEST_CASE("Duration round trips")
+{
+    for (auto delta : {Days(1) - Seconds(3661), -Useconds(1),
+                       Days(-5) + Useconds(7), Useconds(INT64_MAX),
+                       Days(INT64_MAX) - Useconds(INT64_MAX)})
+    {
+        REQUIRE(parseDuration(toString(delta)) == delta);
+    }
+}
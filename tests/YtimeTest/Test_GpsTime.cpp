@@ -0,0 +1,41 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/GpsTime.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("GPS epoch and week rollovers")
+{
+    REQUIRE(toGpsTimeUsecs(pack({{1980, 1, 6}, {0, 0, 0}})) == 0);
+    REQUIRE(toGpsTime(pack({{1999, 8, 22}, {0, 0, 0}})) == GpsTime{1024, 13000000});
+    REQUIRE(toGpsTime(pack({{2019, 4, 7}, {0, 0, 0}})) == GpsTime{2048, 18000000});
+    REQUIRE(toGpsTime(pack({{1980, 1, 5}, {23, 59, 59}}))
+            == GpsTime{-1, USECS_PER_GPS_WEEK - 1000000});
+}
+
+TEST_CASE("GPS time across a leap second")
+{
+    auto leap = pack({{2016, 12, 31}, {23, 59, 60}});
+    auto before = toGpsTimeUsecs(PackedDateTime(leap - 1000000));
+    REQUIRE(toGpsTimeUsecs(leap) == before + 1000000);
+    REQUIRE(fromGpsTimeUsecs(toGpsTimeUsecs(leap)) == leap);
+    /* GPS - UTC is 18 seconds after the leap second. */
+    auto gps = toGpsTime(pack({{2017, 1, 1}, {0, 0, 0}}));
+    REQUIRE(gps == GpsTime{1930, 18000000});
+    REQUIRE(fromGpsTime(gps) == pack({{2017, 1, 1}, {0, 0, 0}}));
+
+    PackedDateTime values[] = {leap, PackedDateTime(leap + 1)};
+    int64_t usecs[2];
+    PackedDateTime back[2];
+    toGpsTimeUsecs(values, 2, usecs);
+    fromGpsTimeUsecs(usecs, 2, back);
+    REQUIRE(usecs[1] == usecs[0] + 1);
+    REQUIRE(back[0] == values[0]);
+    REQUIRE(back[1] == values[1]);
+}
@@ -0,0 +1,89 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/Instrumentation.hpp"
+#include <thread>
+#include <vector>
+#include "Ytime/UnixTime.hpp"
+#include "Ytime/YtimeException.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    void doSomeWork()
+    {
+        auto leap = pack({{2016, 12, 31}, {23, 59, 60}});
+        /* Adding a day to midnight before the leap second steps over
+           the leap second. */
+        add(PackedDateTime(leap - USECS_PER_DAY), Days(1));
+        parseDateTime("not a date");
+        try
+        {
+            add(leap, Days(1));
+        }
+        catch (YtimeException&)
+        {}
+        std::vector<PackedDateTime> values(1000, leap);
+        std::vector<int64_t> result(values.size());
+        toUnixTimeUsecs(values.data(), values.size(), result.data());
+    }
+}
+
+TEST_CASE("Instrumentation counters")
+{
+    setBatchSamplingInterval(1);
+    resetInstrumentationCounters();
+    auto before = getThreadInstrumentationCounters();
+    doSomeWork();
+    auto counters = getThreadInstrumentationCounters() - before;
+
+    if (!isInstrumentationEnabled())
+    {
+        REQUIRE(counters.calls == 0);
+        REQUIRE(getInstrumentationCounters().calls == 0);
+        return;
+    }
+
+    REQUIRE(counters.calls >= 3);
+    REQUIRE(counters.slowPaths >= 2);
+    REQUIRE(counters.leapSecondHits >= 1);
+    REQUIRE(counters.parseFailures == 1);
+    REQUIRE(counters.throws == 1);
+    REQUIRE(counters.batchCalls == 1);
+    REQUIRE(counters.batchValues == 1000);
+    REQUIRE(counters.sampledBatches == 1);
+
+    auto total = getInstrumentationCounters();
+    REQUIRE(total.throws == 1);
+    REQUIRE(total.parseFailures == 1);
+    setBatchSamplingInterval(64);
+}
+
+TEST_CASE("Instrumentation counters of finished threads")
+{
+    resetInstrumentationCounters();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back(doSomeWork);
+    for (auto& thread : threads)
+        thread.join();
+
+    auto total = getInstrumentationCounters();
+    if (!isInstrumentationEnabled())
+    {
+        REQUIRE(total.calls == 0);
+        return;
+    }
+
+    REQUIRE(total.throws == 4);
+    REQUIRE(total.parseFailures == 4);
+    REQUIRE(total.batchValues == 4000);
+    resetInstrumentationCounters();
+    REQUIRE(getInstrumentationCounters().throws == 0);
+}
@@ -0,0 +1,73 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/IntervalSet.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    PackedDateTime at(int hour, int minute = 0)
+    {
+        return pack({{2024, 3, 1}, {hour, minute, 0}});
+    }
+
+    Interval interval(int fromHour, int toHour)
+    {
+        return {at(fromHour), at(toHour)};
+    }
+}
+
+TEST_CASE("IntervalSet construction merges unsorted intervals")
+{
+    IntervalSet set({interval(10, 12), interval(1, 2), interval(11, 14),
+                     interval(2, 3), interval(5, 5), interval(20, 21)});
+    REQUIRE(set.size() == 3);
+    REQUIRE(set[0] == interval(1, 3));
+    REQUIRE(set[1] == interval(10, 14));
+    REQUIRE(set[2] == interval(20, 21));
+    REQUIRE(set.totalDuration() == Seconds(7 * 3600));
+}
+
+TEST_CASE("IntervalSet set operations")
+{
+    IntervalSet sessions({interval(8, 12), interval(13, 17)});
+    IntervalSet outages({interval(11, 14), interval(16, 18)});
+
+    REQUIRE((sessions | outages) == IntervalSet({interval(8, 18)}));
+    REQUIRE((sessions & outages)
+            == IntervalSet({interval(11, 12), interval(13, 14),
+                            interval(16, 17)}));
+    REQUIRE((sessions - outages)
+            == IntervalSet({interval(8, 11), interval(14, 16)}));
+    REQUIRE((sessions - sessions).empty());
+
+    auto set = sessions;
+    set.insert(at(12), at(13));
+    REQUIRE(set == IntervalSet({interval(8, 17)}));
+}
+
+TEST_CASE("IntervalSet contains")
+{
+    IntervalSet set({interval(8, 12), interval(13, 17)});
+    REQUIRE(!set.contains(at(7, 59)));
+    REQUIRE(set.contains(at(8)));
+    REQUIRE(!set.contains(at(12)));
+    REQUIRE(set.contains(at(16, 59)));
+    REQUIRE(!set.contains(at(17)));
+
+    std::vector<PackedDateTime> values;
+    for (int i = 0; i < 24 * 4; ++i)
+        values.push_back(at(i / 4, (i % 4) * 15));
+    values.push_back(at(9));
+    values.push_back(at(12, 30));
+    bool result[24 * 4 + 2];
+    set.contains(values.data(), values.size(), result);
+    for (size_t i = 0; i < values.size(); ++i)
+        REQUIRE(result[i] == set.contains(values[i]));
+}
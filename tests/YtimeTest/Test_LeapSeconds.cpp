@@ -6,6 +6,11 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Ytime/LeapSeconds.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Ytime/UnixTime.hpp"
+#include "Ytime/Detail/LeapSecondTable.hpp"
 #include <catch2/catch.hpp>
 
 TEST_CASE("getLeapSeconds for DateTime")
@@ -19,3 +24,136 @@ TEST_CASE("isLeapSecond for DateTime")
     using namespace Ytime;
     REQUIRE(isLeapSecond({{2016, 12, 31}, {23, 59, 60}}));
 }
+
+namespace
+{
+    #define LEAP_SECOND_LINES \
+        "2272060800\t10\t# 1 Jan 1972\n" \
+        "2287785600\t11\t# 1 Jul 1972\n" \
+        "2303683200\t12\t# 1 Jan 1973\n" \
+        "2335219200\t13\t# 1 Jan 1974\n" \
+        "2366755200\t14\t# 1 Jan 1975\n" \
+        "2398291200\t15\t# 1 Jan 1976\n" \
+        "2429913600\t16\t# 1 Jan 1977\n" \
+        "2461449600\t17\t# 1 Jan 1978\n" \
+        "2492985600\t18\t# 1 Jan 1979\n" \
+        "2524521600\t19\t# 1 Jan 1980\n" \
+        "2571782400\t20\t# 1 Jul 1981\n" \
+        "2603318400\t21\t# 1 Jul 1982\n" \
+        "2634854400\t22\t# 1 Jul 1983\n" \
+        "2698012800\t23\t# 1 Jul 1985\n" \
+        "2776982400\t24\t# 1 Jan 1988\n" \
+        "2840140800\t25\t# 1 Jan 1990\n" \
+        "2871676800\t26\t# 1 Jan 1991\n" \
+        "2918937600\t27\t# 1 Jul 1992\n" \
+        "2950473600\t28\t# 1 Jul 1993\n" \
+        "2982009600\t29\t# 1 Jul 1994\n" \
+        "3029443200\t30\t# 1 Jan 1996\n" \
+        "3076704000\t31\t# 1 Jul 1997\n" \
+        "3124137600\t32\t# 1 Jan 1999\n" \
+        "3345062400\t33\t# 1 Jan 2006\n" \
+        "3439756800\t34\t# 1 Jan 2009\n" \
+        "3550089600\t35\t# 1 Jul 2012\n" \
+        "3644697600\t36\t# 1 Jul 2015\n" \
+        "3692217600\t37\t# 1 Jan 2017\n"
+
+    constexpr char LEAP_SECONDS_LIST[] =
+        "#\tUpdated through IERS Bulletin C\n"
+        "#$\t3960835200\n"
+        "#@\t3991593600\n"
+        LEAP_SECOND_LINES
+        "#h\t49db2447 571e5e1b 2f002a53 9c8da8e4 39b8e49e\n";
+
+    /* Has a made-up leap second at the end of 2029. */
+    constexpr char FUTURE_LEAP_SECONDS_LIST[] =
+        "#$\t3960835200\n"
+        "#@\t4117996800\n"
+        LEAP_SECOND_LINES
+        "4102444800\t38\t# 1 Jan 2030\n"
+        "#h\t4bd34ee5 1b0b821d 6dd9142d 9ec11a38 f8c31783\n";
+
+    #undef LEAP_SECOND_LINES
+}
+
+TEST_CASE("Load leap second list")
+{
+    using namespace Ytime;
+    setLeapSecondList(LEAP_SECONDS_LIST);
+    REQUIRE(getLeapSecondListExpiration() == Date(2026, 6, 28));
+    REQUIRE(!isLeapSecondListExpired(pack({{2026, 6, 27}, {23, 59, 59}})));
+    REQUIRE(isLeapSecondListExpired(pack({{2026, 6, 28}, {0, 0, 0}})));
+    REQUIRE(getLeapSeconds({{2017, 1, 1}, {0, 0, 0}}) == 27);
+
+    setLeapSecondList(FUTURE_LEAP_SECONDS_LIST);
+    REQUIRE(getLeapSecondListExpiration() == Date(2030, 6, 30));
+    REQUIRE(hasLeapSecond({2029, 12, 31}));
+    REQUIRE(isLeapSecond({{2029, 12, 31}, {23, 59, 60}}));
+    REQUIRE(getLeapSeconds({{2030, 1, 1}, {0, 0, 0}}) == 28);
+    REQUIRE(unpack(fromUnixTime(1893456000)) == DateTime({2030, 1, 1}, {0, 0, 0}));
+
+    resetLeapSecondList();
+    REQUIRE(!getLeapSecondListExpiration());
+    REQUIRE(!hasLeapSecond({2029, 12, 31}));
+}
+
+TEST_CASE("Reject invalid leap second lists")
+{
+    using namespace Ytime;
+    std::string text = LEAP_SECONDS_LIST;
+    text.replace(text.find("\t37\t"), 4, "\t38\t");
+    REQUIRE_THROWS_AS(setLeapSecondList(text), YtimeException);
+    REQUIRE_THROWS_AS(setLeapSecondList("#$\t1\n"), YtimeException);
+    REQUIRE(!getLeapSecondListExpiration());
+}
+
+TEST_CASE("Loading an identical leap second list reuses the table")
+{
+    using namespace Ytime;
+    setLeapSecondList(FUTURE_LEAP_SECONDS_LIST);
+    auto table = &Detail::getLeapSecondData();
+    setLeapSecondList(FUTURE_LEAP_SECONDS_LIST);
+    REQUIRE(&Detail::getLeapSecondData() == table);
+
+    resetLeapSecondList();
+    REQUIRE(&Detail::getLeapSecondData()
+            == &Detail::getBuiltInLeapSecondData());
+    setLeapSecondList(FUTURE_LEAP_SECONDS_LIST);
+    REQUIRE(&Detail::getLeapSecondData() == table);
+
+    setLeapSecondList(LEAP_SECONDS_LIST);
+    REQUIRE(&Detail::getLeapSecondData() != table);
+    REQUIRE(getLeapSecondListExpiration() == Date(2026, 6, 28));
+    resetLeapSecondList();
+}
+
+TEST_CASE("Leap second lookups while the list is replaced")
+{
+    using namespace Ytime;
+    auto before = pack({{2029, 12, 31}, {23, 59, 59}});
+    auto after = PackedDateTime(before + 2 * USECS_PER_SEC);
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&]
+        {
+            while (!done)
+            {
+                auto n = getLeapSeconds(after) - getLeapSeconds(before);
+                auto unixDelta = toUnixTime(after) - toUnixTime(before);
+                if (n > 1 || unixDelta < 1 || unixDelta > 2)
+                    consistent = false;
+            }
+        });
+    }
+    for (int i = 0; i < 1000; ++i)
+    {
+        setLeapSecondList(FUTURE_LEAP_SECONDS_LIST);
+        resetLeapSecondList();
+    }
+    done = true;
+    for (auto& reader : readers)
+        reader.join();
+    REQUIRE(consistent);
+}
@@ -0,0 +1,78 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/LeapSmear.hpp"
+#include <vector>
+#include "Ytime/UnixTime.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("Linear smear around the 2016 leap second")
+{
+    LeapSmear smear;
+    auto leap = pack({{2016, 12, 31}, {23, 59, 60}});
+    auto midnight = pack({{2017, 1, 1}, {0, 0, 0}});
+    auto noonBefore = pack({{2016, 12, 31}, {12, 0, 0}});
+    auto noonAfter = pack({{2017, 1, 1}, {12, 0, 0}});
+
+    REQUIRE(toSmearedUnixTimeUsecs(noonBefore, smear)
+            == toUnixTimeUsecs(noonBefore));
+    REQUIRE(toSmearedUnixTimeUsecs(noonAfter, smear)
+            == toUnixTimeUsecs(noonAfter));
+    /* Half way through the window the smeared clock has lost half a
+       second. */
+    REQUIRE(unpackSmeared(leap, smear)
+            == DateTime({2016, 12, 31}, {23, 59, 59, 500006}));
+    REQUIRE(toSmearedUnixTimeUsecs(midnight, smear)
+            == toUnixTimeUsecs(midnight) + 499994);
+
+    for (auto t : {noonBefore, leap, midnight, noonAfter,
+                   PackedDateTime(midnight + 12345678)})
+    {
+        auto smeared = toSmearedUnixTimeUsecs(t, smear);
+        REQUIRE(fromSmearedUnixTimeUsecs(smeared, smear) == t);
+    }
+    REQUIRE(packSmeared({{2017, 1, 1}, {0, 0, 0}}, smear)
+            == PackedDateTime(leap + 500000));
+}
+
+TEST_CASE("Cosine smear is monotonic and round-trips")
+{
+    LeapSmear smear{Seconds(1000), Seconds(400), SmearShape::COSINE};
+    auto start = pack({{2016, 12, 31}, {23, 53, 0}});
+    int64_t prev = INT64_MIN;
+    for (int64_t i = 0; i < 1200; ++i)
+    {
+        auto t = PackedDateTime(start + i * USECS_PER_SEC);
+        auto smeared = toSmearedUnixTimeUsecs(t, smear);
+        REQUIRE(smeared > prev);
+        REQUIRE(fromSmearedUnixTimeUsecs(smeared, smear) == t);
+        prev = smeared;
+    }
+    REQUIRE_THROWS_AS(toSmearedUnixTimeUsecs(start, {Seconds(10), Seconds(20)}),
+                      YtimeException);
+}
+
+TEST_CASE("Batch smear conversions match the scalar ones")
+{
+    LeapSmear smear;
+    std::vector<PackedDateTime> values;
+    auto start = pack({{2016, 12, 20}, {0, 0, 0}});
+    for (int64_t i = 0; i < 20000; ++i)
+        values.push_back(PackedDateTime(start + i * 127 * USECS_PER_SEC));
+
+    std::vector<int64_t> smeared(values.size());
+    toSmearedUnixTimeUsecs(values.data(), values.size(), smeared.data(), smear);
+    std::vector<PackedDateTime> packed(values.size());
+    fromSmearedUnixTimeUsecs(smeared.data(), smeared.size(), packed.data(), smear);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        REQUIRE(smeared[i] == toSmearedUnixTimeUsecs(values[i], smear));
+        REQUIRE(packed[i] == values[i]);
+    }
+}
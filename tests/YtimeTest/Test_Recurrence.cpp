@@ -0,0 +1,143 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/Recurrence.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    std::vector<DateTime> take(const RecurrenceRange& range, size_t n)
+    {
+        std::vector<DateTime> result;
+        for (auto it = range.begin(); it != range.end() && result.size() < n; ++it)
+            result.push_back(unpack(*it));
+        return result;
+    }
+}
+
+TEST_CASE("Recurrence every second Tuesday of the month")
+{
+    RecurrenceRule rule(pack({{2024, 1, 1}, {10, 0, 0}}), Frequency::MONTHLY);
+    rule.addWeekday(2, 2);
+    auto result = take(rule.occurrences(), 3);
+    REQUIRE(result.size() == 3);
+    REQUIRE(result[0] == DateTime({2024, 1, 9}, {10, 0, 0}));
+    REQUIRE(result[1] == DateTime({2024, 2, 13}, {10, 0, 0}));
+    REQUIRE(result[2] == DateTime({2024, 3, 12}, {10, 0, 0}));
+
+    auto next = rule.next(pack({{2030, 6, 12}, {0, 0, 0}}));
+    REQUIRE(next);
+    REQUIRE(unpack(*next) == DateTime({2030, 7, 9}, {10, 0, 0}));
+}
+
+TEST_CASE("Recurrence last weekday of the month")
+{
+    RecurrenceRule rule(pack({{2024, 1, 1}, {0, 0, 0}}), Frequency::MONTHLY);
+    rule.setWeekdays({1, 2, 3, 4, 5}).setPositions({-1});
+    auto result = take(rule.occurrences(), 4);
+    REQUIRE(result.size() == 4);
+    REQUIRE(result[0].date == Date(2024, 1, 31));
+    REQUIRE(result[1].date == Date(2024, 2, 29));
+    REQUIRE(result[2].date == Date(2024, 3, 29));
+    REQUIRE(result[3].date == Date(2024, 4, 30));
+}
+
+TEST_CASE("Recurrence every 15 minutes during office hours")
+{
+    RecurrenceRule rule(pack({{2024, 3, 8}, {0, 0, 0}}), Frequency::MINUTELY, 15);
+    rule.setHours({8, 9, 10, 11, 12, 13, 14, 15, 16})
+        .setWeekdays({1, 2, 3, 4, 5});
+    auto range = rule.occurrencesFrom(pack({{2024, 3, 8}, {16, 40, 0}}));
+    auto result = take(range, 3);
+    REQUIRE(result.size() == 3);
+    REQUIRE(result[0] == DateTime({2024, 3, 8}, {16, 45, 0}));
+    REQUIRE(result[1] == DateTime({2024, 3, 11}, {8, 0, 0}));
+    REQUIRE(result[2] == DateTime({2024, 3, 11}, {8, 15, 0}));
+}
+
+TEST_CASE("Recurrence across a leap second")
+{
+    RecurrenceRule rule(pack({{2016, 12, 31}, {23, 0, 0}}), Frequency::MINUTELY, 30);
+    auto result = take(rule.occurrences(), 4);
+    REQUIRE(result.size() == 4);
+    REQUIRE(result[2] == DateTime({2017, 1, 1}, {0, 0, 0}));
+    REQUIRE(result[3] == DateTime({2017, 1, 1}, {0, 30, 0}));
+
+    auto next = rule.next(pack({{2016, 12, 31}, {23, 59, 60}}));
+    REQUIRE(next);
+    REQUIRE(unpack(*next) == DateTime({2017, 1, 1}, {0, 0, 0}));
+}
+
+TEST_CASE("Recurrence with count and until")
+{
+    RecurrenceRule rule(pack({{2024, 1, 31}, {12, 0, 0}}), Frequency::MONTHLY);
+    rule.setCount(3);
+    auto result = take(rule.occurrences(), 10);
+    REQUIRE(result.size() == 3);
+    REQUIRE(result[1].date == Date(2024, 3, 31));
+    REQUIRE(result[2].date == Date(2024, 5, 31));
+    REQUIRE(!rule.next(pack({{2024, 6, 1}, {0, 0, 0}})));
+
+    RecurrenceRule yearly(pack({{2024, 2, 29}, {0, 0, 0}}), Frequency::YEARLY);
+    yearly.setUntil(pack({{2032, 2, 29}, {0, 0, 0}}));
+    result = take(yearly.occurrences(), 10);
+    REQUIRE(result.size() == 3);
+    REQUIRE(result[1].date == Date(2028, 2, 29));
+    REQUIRE(result[2].date == Date(2032, 2, 29));
+}
+
+TEST_CASE("Recurrence without occurrences")
+{
+    RecurrenceRule rule(pack({{2024, 1, 1}, {0, 0, 0}}), Frequency::YEARLY);
+    rule.setMonths({2}).setMonthDays({30});
+    REQUIRE(rule.occurrences().begin() == rule.occurrences().end());
+    REQUIRE_THROWS_AS(RecurrenceRule(pack({{2024, 1, 1}, {0, 0, 0}}),
+                                     Frequency::DAILY).addWeekday(1, 2),
+                      YtimeException);
+}
+
+TEST_CASE("Recurrence jumps match iteration")
+{
+    RecurrenceRule rule(pack({{2023, 5, 17}, {6, 30, 0}}), Frequency::WEEKLY, 2);
+    rule.setWeekdays({1, 4});
+    auto it = rule.occurrences().begin();
+    for (int i = 0; i < 50; ++i, ++it)
+    {
+        auto prev = PackedDateTime(*it - 1);
+        auto next = rule.next(prev);
+        REQUIRE(next);
+        REQUIRE(*next == *it);
+    }
+}
+
+TEST_CASE("Recurrence range outlives its rule")
+{
+    auto start = pack({{2024, 1, 1}, {8, 0, 0}});
+    std::vector<DateTime> result;
+    for (auto t : RecurrenceRule(start, Frequency::DAILY).occurrences())
+    {
+        result.push_back(unpack(t));
+        if (result.size() == 3)
+            break;
+    }
+    REQUIRE(result == std::vector<DateTime>{
+        DateTime({2024, 1, 1}, {8, 0, 0}),
+        DateTime({2024, 1, 2}, {8, 0, 0}),
+        DateTime({2024, 1, 3}, {8, 0, 0})});
+
+    auto it = RecurrenceRule(start, Frequency::WEEKLY).setCount(2)
+        .occurrencesFrom(pack({{2024, 1, 2}, {0, 0, 0}})).begin();
+    REQUIRE(unpack(*it) == DateTime({2024, 1, 8}, {8, 0, 0}));
+    REQUIRE(++it == RecurrenceIterator());
+
+    RecurrenceRule rule(start, Frequency::DAILY);
+    auto range = rule.occurrences();
+    rule.setCount(1);
+    REQUIRE(take(range, 2).size() == 2);
+}
@@ -0,0 +1,104 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimeWindow.hpp"
+#include <thread>
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    PackedDateTime at(int64_t second)
+    {
+        return PackedDateTime(pack({{2024, 3, 1}, {12, 0, 0}})
+                              + second * USECS_PER_SEC);
+    }
+}
+
+TEST_CASE("SlidingWindow evicts old values")
+{
+    SlidingWindow window(Seconds(300), 1000);
+    for (int i = 0; i < 600; ++i)
+        REQUIRE(window.insert(at(i), 2));
+    auto aggregate = window.aggregate();
+    REQUIRE(aggregate.count == 300);
+    REQUIRE(aggregate.sum == 600);
+    REQUIRE(window.latest() == at(599));
+
+    REQUIRE(!window.insert(at(100)));
+    window.advance(at(800));
+    REQUIRE(window.aggregate().count == 99);
+    window.advance(at(1000));
+    REQUIRE(window.aggregate().count == 0);
+}
+
+TEST_CASE("SlidingWindow with full buffer")
+{
+    SlidingWindow window(Seconds(10), 4);
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(window.insert(at(i)));
+    REQUIRE(!window.insert(at(5)));
+    REQUIRE(window.insert(at(10)));
+    REQUIRE(window.aggregate().count == 4);
+}
+
+TEST_CASE("TumblingWindow hour buckets")
+{
+    TumblingWindow window(CalendarUnit::HOUR, 3);
+    REQUIRE(!window.current());
+    for (int i = 0; i < 4 * 3600; i += 60)
+        REQUIRE(window.insert(at(i), 1));
+
+    auto current = window.current();
+    REQUIRE(current);
+    REQUIRE(unpack(current->start) == DateTime({2024, 3, 1}, {15, 0, 0}));
+    REQUIRE(unpack(current->end) == DateTime({2024, 3, 1}, {16, 0, 0}));
+    REQUIRE(current->aggregate.count == 60);
+
+    REQUIRE(window.bucket(at(3600))->aggregate.sum == 60);
+    REQUIRE(!window.bucket(at(0)));
+    REQUIRE(!window.insert(at(10)));
+
+    REQUIRE(window.insert(at(7 * 3600)));
+    REQUIRE(window.bucket(at(6 * 3600))->aggregate.count == 0);
+    REQUIRE(!window.bucket(at(3 * 3600)));
+}
+
+TEST_CASE("TumblingWindow month buckets and leap seconds")
+{
+    TumblingWindow window(CalendarUnit::MONTH, 12);
+    REQUIRE(window.insert(pack({{2016, 12, 31}, {23, 59, 60}})));
+    REQUIRE(window.insert(pack({{2017, 1, 1}, {0, 0, 0}})));
+    auto dec = window.bucket(pack({{2016, 12, 1}, {0, 0, 0}}));
+    REQUIRE(dec);
+    REQUIRE(dec->aggregate.count == 1);
+    REQUIRE(dec->end == pack({{2017, 1, 1}, {0, 0, 0}}));
+    REQUIRE(window.current()->aggregate.count == 1);
+}
+
+TEST_CASE("TumblingWindow with a concurrent reader")
+{
+    TumblingWindow window(CalendarUnit::MINUTE, 10);
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+    std::thread reader([&]
+    {
+        while (!done)
+        {
+            auto bucket = window.current();
+            if (bucket && bucket->aggregate.sum != bucket->aggregate.count)
+                consistent = false;
+        }
+    });
+    for (int i = 0; i < 100000; ++i)
+        window.insert(at(i / 100 * 60), 1);
+    done = true;
+    reader.join();
+    REQUIRE(consistent);
+    REQUIRE(window.current()->aggregate.count == 100);
+}
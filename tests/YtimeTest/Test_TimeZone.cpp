@@ -0,0 +1,146 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimeZone.hpp"
+
+#include <fstream>
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    void appendInt32(std::string& s, uint32_t value)
+    {
+        for (int i = 3; i >= 0; --i)
+            s.push_back(char((value >> (8 * i)) & 0xFFu));
+    }
+
+    /* Returns a TZif file without transitions and with a
+       single local time type, followed by the given TZ string. */
+    std::string makeTzif(int32_t offset, const std::string& tz)
+    {
+        std::string block;
+        block += "TZif2";
+        block.append(15, '\0');
+        for (uint32_t count : {0u, 0u, 0u, 0u, 1u, 4u})
+            appendInt32(block, count);
+        appendInt32(block, uint32_t(offset));
+        block += '\0';
+        block += '\0';
+        block += std::string("XXX\0", 4);
+        return block + block + "\n" + tz + "\n";
+    }
+
+    const TimeZone& getNewYork()
+    {
+        static auto data = makeTzif(-5 * 3600, "EST5EDT,M3.2.0,M11.1.0");
+        static auto tz = parseTzif(data.data(), data.size(), "New York");
+        return tz;
+    }
+}
+
+TEST_CASE("UTC time zone")
+{
+    TimeZone tz;
+    auto t = pack({{2016, 12, 31}, {23, 59, 60}});
+    REQUIRE(tz.getUtcOffset(t) == 0);
+    REQUIRE(tz.toLocal(t) == DateTime({2016, 12, 31}, {23, 59, 60}));
+    REQUIRE(tz.toUtc({{2016, 12, 31}, {23, 59, 60}}) == t);
+}
+
+TEST_CASE("Time zone from POSIX TZ string")
+{
+    auto& tz = getNewYork();
+    REQUIRE(tz.getUtcOffset(pack({{2024, 1, 15}, {12, 0, 0}})) == -5 * 3600);
+    REQUIRE(tz.getUtcOffset(pack({{2024, 7, 1}, {12, 0, 0}})) == -4 * 3600);
+    REQUIRE(tz.getUtcOffset(pack({{2150, 7, 1}, {12, 0, 0}})) == -4 * 3600);
+
+    REQUIRE(tz.toLocal(pack({{2024, 3, 10}, {6, 59, 59}}))
+            == DateTime({2024, 3, 10}, {1, 59, 59}));
+    REQUIRE(tz.toLocal(pack({{2024, 3, 10}, {7, 0, 0}}))
+            == DateTime({2024, 3, 10}, {3, 0, 0}));
+    REQUIRE(tz.toLocal(pack({{2017, 1, 1}, {0, 0, 0}}))
+            == DateTime({2016, 12, 31}, {19, 0, 0}));
+}
+
+TEST_CASE("Local time to UTC with leap second")
+{
+    auto& tz = getNewYork();
+    auto t = pack({{2016, 12, 31}, {23, 59, 60}});
+    REQUIRE(tz.toLocal(t) == DateTime({2016, 12, 31}, {18, 59, 60}));
+    REQUIRE(tz.toUtc({{2016, 12, 31}, {18, 59, 60}}) == t);
+}
+
+TEST_CASE("Nonexistent local time")
+{
+    auto& tz = getNewYork();
+    DateTime local({2024, 3, 10}, {2, 30, 0});
+    REQUIRE(tz.toUtc(local, LocalTimePolicy::OFFSET_BEFORE_TRANSITION)
+            == pack({{2024, 3, 10}, {7, 30, 0}}));
+    REQUIRE(tz.toUtc(local, LocalTimePolicy::OFFSET_AFTER_TRANSITION)
+            == pack({{2024, 3, 10}, {6, 30, 0}}));
+    REQUIRE_THROWS_AS(tz.toUtc(local, LocalTimePolicy::THROW),
+                      YtimeException);
+}
+
+TEST_CASE("Ambiguous local time")
+{
+    auto& tz = getNewYork();
+    DateTime local({2024, 11, 3}, {1, 30, 0});
+    REQUIRE(tz.toUtc(local, LocalTimePolicy::OFFSET_BEFORE_TRANSITION)
+            == pack({{2024, 11, 3}, {5, 30, 0}}));
+    REQUIRE(tz.toUtc(local, LocalTimePolicy::OFFSET_AFTER_TRANSITION)
+            == pack({{2024, 11, 3}, {6, 30, 0}}));
+    REQUIRE_THROWS_AS(tz.toUtc(local, LocalTimePolicy::THROW),
+                      YtimeException);
+}
+
+TEST_CASE("Batch time zone conversions")
+{
+    auto& tz = getNewYork();
+    std::vector<PackedDateTime> utc;
+    for (int i = 0; i < 24 * 400; ++i)
+        utc.push_back(add(pack({{2024, 1, 1}, {0, 0, 0}}), Seconds(i * 3600)));
+
+    std::vector<DateTime> local(utc.size());
+    tz.toLocal(utc.data(), utc.size(), local.data());
+    std::vector<PackedDateTime> roundTrip(utc.size());
+    tz.toUtc(local.data(), local.size(), roundTrip.data(),
+             LocalTimePolicy::OFFSET_BEFORE_TRANSITION);
+    for (size_t i = 0; i < utc.size(); ++i)
+    {
+        REQUIRE(local[i] == tz.toLocal(utc[i]));
+        /* The second 01:xx on the day DST ends is ambiguous. */
+        if (local[i] != DateTime({2024, 11, 3}, {1, 0, 0}) || i == 0
+            || local[i - 1] != local[i])
+        {
+            REQUIRE(roundTrip[i] == utc[i]);
+        }
+    }
+}
+
+TEST_CASE("Time zone from system tzdata")
+{
+    if (!std::ifstream("/usr/share/zoneinfo/Europe/Oslo"))
+    {
+        WARN("No tzdata, skipping test.");
+        return;
+    }
+    auto tz = loadTimeZone("Europe/Oslo");
+    REQUIRE(tz.getUtcOffset(pack({{2024, 1, 15}, {12, 0, 0}})) == 3600);
+    REQUIRE(tz.getUtcOffset(pack({{2024, 7, 1}, {12, 0, 0}})) == 7200);
+    REQUIRE(tz.getUtcOffset(pack({{1944, 7, 1}, {12, 0, 0}})) == 7200);
+    REQUIRE(tz.toLocal(pack({{2016, 12, 31}, {23, 59, 60}}))
+            == DateTime({2017, 1, 1}, {0, 59, 60}));
+    REQUIRE(tz.toUtc({{2024, 10, 27}, {2, 30, 0}},
+                     LocalTimePolicy::OFFSET_AFTER_TRANSITION)
+            == pack({{2024, 10, 27}, {1, 30, 0}}));
+
+    REQUIRE_THROWS_AS(loadTimeZone("../etc/passwd"), YtimeException);
+    REQUIRE_THROWS_AS(loadTimeZone("No/Such_Zone"), YtimeException);
+}
@@ -0,0 +1,47 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampAnalysis.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("analyzeTimestamps finds gaps, duplicates and inversions")
+{
+    std::vector<PackedDateTime> values;
+    auto start = pack({{2024, 3, 1}, {0, 0, 0}});
+    for (int i = 0; i < 1000; ++i)
+        values.push_back(PackedDateTime(start + i * USECS_PER_SEC));
+    values.erase(values.begin() + 500, values.begin() + 510);
+    values.insert(values.begin() + 700, values[699]);
+    values.insert(values.begin() + 800, values[798]);
+
+    auto result = analyzeTimestamps(values.data(), values.size(), Seconds(2));
+    REQUIRE(result.gaps.size() == 1);
+    REQUIRE(result.gaps[0].index == 500);
+    REQUIRE(result.gaps[0].start == values[499]);
+    REQUIRE(result.gaps[0].length == Seconds(11));
+    REQUIRE(result.duplicates == std::vector<size_t>{700});
+    REQUIRE(result.inversions == std::vector<size_t>{800});
+    REQUIRE(result.minInterval == Seconds(1));
+    REQUIRE(result.maxInterval == Seconds(11));
+    REQUIRE(result.medianInterval == Seconds(1));
+}
+
+TEST_CASE("analyzeTimestamps across a leap second")
+{
+    std::vector<PackedDateTime> values;
+    auto start = pack({{2016, 12, 31}, {23, 59, 58}});
+    for (int i = 0; i < 5; ++i)
+        values.push_back(PackedDateTime(start + i * USECS_PER_SEC));
+    REQUIRE(unpack(values[2]).time == Time(23, 59, 60));
+
+    auto result = analyzeTimestamps(values.data(), values.size(), Seconds(1));
+    REQUIRE(result.gaps.empty());
+    REQUIRE(result.intervalCount == 4);
+    REQUIRE(result.maxInterval == Seconds(1));
+}
@@ -0,0 +1,88 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampDictionary.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    PackedDateTime at(int64_t second)
+    {
+        return PackedDateTime(pack({{2024, 3, 1}, {12, 0, 0}})
+                              + second * USECS_PER_SEC);
+    }
+}
+
+TEST_CASE("TimestampDictionary encodes and decodes")
+{
+    std::vector<PackedDateTime> values = {
+        at(5), at(5), at(2), at(9), at(5), at(2), at(2), at(7)
+    };
+    TimestampDictionary dictionary(values.data(), values.size());
+    REQUIRE(dictionary.values() == std::vector<PackedDateTime>{
+        at(2), at(5), at(7), at(9)});
+    REQUIRE(dictionary.codeSize() == 1);
+    REQUIRE(dictionary.find(at(7)) == 2);
+    REQUIRE(dictionary.find(at(8)) == -1);
+
+    std::vector<uint8_t> codes(values.size());
+    dictionary.encode(values.data(), values.size(), codes.data());
+    REQUIRE(codes == std::vector<uint8_t>{1, 1, 0, 3, 1, 0, 0, 2});
+
+    std::vector<PackedDateTime> decoded(codes.size());
+    dictionary.decode(codes.data(), codes.size(), decoded.data());
+    REQUIRE(decoded == values);
+
+    auto missing = at(8);
+    REQUIRE_THROWS_AS(dictionary.encode(&missing, 1, codes.data()),
+                      YtimeException);
+}
+
+TEST_CASE("TimestampDictionary code sizes")
+{
+    std::vector<PackedDateTime> values;
+    for (int i = 0; i < 300; ++i)
+        values.push_back(at(299 - i));
+    TimestampDictionary dictionary(values.data(), values.size());
+    REQUIRE(dictionary.size() == 300);
+    REQUIRE(dictionary.codeSize() == 2);
+
+    std::vector<uint8_t> codes8(values.size());
+    REQUIRE_THROWS_AS(dictionary.encode(values.data(), values.size(),
+                                        codes8.data()),
+                      YtimeException);
+    std::vector<uint32_t> codes32(values.size());
+    dictionary.encode(values.data(), values.size(), codes32.data());
+    REQUIRE(codes32[0] == 299);
+    REQUIRE(codes32[299] == 0);
+
+    REQUIRE(TimestampDictionary().size() == 0);
+    REQUIRE(TimestampDictionary().find(at(0)) == -1);
+}
+
+TEST_CASE("TimestampDictionary range predicates")
+{
+    std::vector<PackedDateTime> values = {at(10), at(20), at(30), at(20)};
+    TimestampDictionary dictionary(values.data(), values.size());
+    REQUIRE(dictionary.findRange(at(15), at(30)) == std::pair<uint32_t, uint32_t>(1, 2));
+    REQUIRE(dictionary.findRange(at(0), at(100)) == std::pair<uint32_t, uint32_t>(0, 3));
+    REQUIRE(dictionary.findRange(at(30), at(20)).second
+            == dictionary.findRange(at(30), at(20)).first);
+
+    std::vector<uint16_t> codes(values.size());
+    dictionary.encode(values.data(), values.size(), codes.data());
+    bool result[4];
+    dictionary.matchRange(codes.data(), codes.size(), at(20), at(31), result);
+    REQUIRE(!result[0]);
+    REQUIRE(result[1]);
+    REQUIRE(result[2]);
+    REQUIRE(result[3]);
+    dictionary.matchRange(codes.data(), codes.size(), at(11), at(20), result);
+    REQUIRE(!(result[0] || result[1] || result[2] || result[3]));
+}
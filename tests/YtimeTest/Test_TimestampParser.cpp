@@ -0,0 +1,64 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampParser.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("Detect ISO date-time with space and milliseconds")
+{
+    std::string_view samples[] = {
+        "2024-05-01 12:00:00.123",
+        "2024-05-01 12:00:01.456",
+        "2024-05-01 12:00:02.5"
+    };
+    auto parser = detectTimestampParser(samples, std::size(samples));
+    REQUIRE(parser.format());
+    REQUIRE(parser.format()->length() == 23);
+
+    auto t = parser.parse("2024-05-01 12:00:03.250");
+    REQUIRE(t);
+    REQUIRE(unpack(*t) == DateTime({2024, 5, 1}, {12, 0, 3, 250000}));
+
+    auto t2 = parser.parse("2024-05-01T12:00:04");
+    REQUIRE(t2);
+    REQUIRE(unpack(*t2) == DateTime({2024, 5, 1}, {12, 0, 4}));
+
+    REQUIRE(!parser.parse("2024-02-30 12:00:00.000"));
+}
+
+TEST_CASE("Detect compact date-time")
+{
+    std::string_view samples[] = {"20240501T120000", "20240501T120001"};
+    auto parser = detectTimestampParser(samples, std::size(samples));
+    REQUIRE(parser.format());
+    auto t = parser.parse("20161231T235960");
+    REQUIRE(t);
+    REQUIRE(unpack(*t) == DateTime({2016, 12, 31}, {23, 59, 60}));
+}
+
+TEST_CASE("Detect time-only values")
+{
+    std::string_view samples[] = {"13:12:10.678", "13:12:11.000"};
+    auto parser = detectTimestampParser(samples, std::size(samples));
+    REQUIRE(parser.format());
+    auto dt = parser.parseDateTime("13:12:12.001");
+    REQUIRE(dt);
+    REQUIRE(dt->time == Time(13, 12, 12, 1000));
+    REQUIRE(!parser.parse("13:12:12.001"));
+}
+
+TEST_CASE("Undetected format falls back to parseDateTime")
+{
+    std::string_view samples[] = {"garbage"};
+    auto parser = detectTimestampParser(samples, std::size(samples));
+    REQUIRE(!parser.format());
+    auto t = parser.parse("2024-5-1T1:2:3");
+    REQUIRE(t);
+    REQUIRE(unpack(*t) == DateTime({2024, 5, 1}, {1, 2, 3}));
+}
@@ -0,0 +1,101 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampScanner.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    TimestampMatch match(size_t offset, size_t length, const DateTime& dt)
+    {
+        return {offset, length, pack(dt)};
+    }
+}
+
+TEST_CASE("Find timestamps in log lines")
+{
+    REQUIRE(findTimestamp("INFO 2024-03-05T10:20:30Z started")
+            == match(5, 20, {{2024, 3, 5}, {10, 20, 30}}));
+    REQUIRE(findTimestamp("[2024-03-05 10:20:30.123] x")
+            == match(1, 23, {{2024, 3, 5}, {10, 20, 30, 123000}}));
+    REQUIRE(findTimestamp("at 2024-03-05.")
+            == match(3, 10, {{2024, 3, 5}, {0, 0, 0}}));
+    REQUIRE(findTimestamp("t=2024-03-05T10:20:30.123456789+02:00;")
+            == match(2, 35, {{2024, 3, 5}, {8, 20, 30, 123456}}));
+    REQUIRE(findTimestamp("t=2024-03-05T00:20:30-0130")
+            == match(2, 24, {{2024, 3, 5}, {1, 50, 30}}));
+    REQUIRE(findTimestamp("t=2024-03-05T00:20:30+0130")
+            == match(2, 24, {{2024, 3, 4}, {22, 50, 30}}));
+}
+
+TEST_CASE("Invalid candidates are skipped")
+{
+    REQUIRE(!findTimestamp(""));
+    REQUIRE(!findTimestamp("2024-03-0"));
+    REQUIRE(!findTimestamp("a-b-c 12024-03-05 2024-13-01 2023-02-29"));
+    REQUIRE(!findTimestamp("2024-03-051"));
+    REQUIRE(!findTimestamp("2016-12-30T23:59:60Z"));
+    REQUIRE(findTimestamp("2024-02-30 id=55-66-77 2024-02-29")
+            == match(23, 10, {{2024, 2, 29}, {0, 0, 0}}));
+    REQUIRE(findTimestamp("2016-12-31T23:59:60Z")
+            == match(0, 20, {{2016, 12, 31}, {23, 59, 60}}));
+    REQUIRE(!findTimestamp("x 2024-05-01T25:00:00+01:00 y"));
+    REQUIRE(!findTimestamp("x 2024-05-01T23:75:00+00:30 y"));
+    REQUIRE(!findTimestamp("x 2024-05-01T12:00:61-01:00 y"));
+}
+
+TEST_CASE("Start position past the end")
+{
+    std::string_view text = "2024-03-05";
+    REQUIRE(findTimestamp(text, text.size()) == std::nullopt);
+    REQUIRE(findTimestamp(text, text.size() + 1) == std::nullopt);
+    REQUIRE(findTimestamp(text, std::string_view::npos) == std::nullopt);
+}
+
+TEST_CASE("Find timestamps in long buffers")
+{
+    /* Long enough to exercise the SIMD loop with matches straddling
+       block boundaries. */
+    std::string text;
+    std::vector<TimestampMatch> expected;
+    for (int i = 0; i < 200; ++i)
+    {
+        text.append(size_t(i % 37), i % 3 == 0 ? '-' : 'x');
+        text += " 1-2-3 ";
+        expected.push_back(match(text.size(), 19,
+                                 {{2020, 1 + i % 12, 1 + i % 28},
+                                  {i % 24, 0, 0}}));
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%04d-%02d-%02dT%02d:00:00",
+                 2020, 1 + i % 12, 1 + i % 28, i % 24);
+        text += buf;
+    }
+
+    std::vector<TimestampMatch> result;
+    findTimestamps(text, result);
+    REQUIRE(result == expected);
+
+    REQUIRE(findTimestamp(text, expected[100].offset + 1) == expected[101]);
+}
+
+TEST_CASE("Find the first timestamp on each line")
+{
+    std::string_view text =
+        "2024-03-05 10:00:00 a 2024-03-06\n"
+        "no timestamp\n"
+        "\n"
+        "[x] 2024-03-07T11:00:00Z";
+    std::vector<TimestampMatch> result;
+    findLineTimestamps(text, result);
+    REQUIRE(result.size() == 4);
+    REQUIRE(result[0] == match(0, 19, {{2024, 3, 5}, {10, 0, 0}}));
+    REQUIRE(result[1] == TimestampMatch{33, 0, {}});
+    REQUIRE(result[2] == TimestampMatch{46, 0, {}});
+    REQUIRE(result[3] == match(51, 20, {{2024, 3, 7}, {11, 0, 0}}));
+}
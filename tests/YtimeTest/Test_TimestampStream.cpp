@@ -0,0 +1,110 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/TimestampStream.hpp"
+#include <string>
+#include "Ytime/YtimeException.hpp"
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+namespace
+{
+    TimestampParser makeParser()
+    {
+        std::string_view sample = "2024-03-05T12:00:00";
+        return detectTimestampParser(&sample, 1);
+    }
+
+    PackedDateTime at(int day, int second)
+    {
+        return pack({{2024, 3, day}, {12, 0, second}});
+    }
+
+    /* Feeds the chunks one at a time and reads until each is consumed. */
+    std::vector<PackedDateTime> readAll(TimestampStream& stream,
+                                        const std::vector<std::string>& chunks)
+    {
+        std::vector<PackedDateTime> result;
+        auto readBatches = [&]
+        {
+            while (true)
+            {
+                auto& batch = stream.read();
+                REQUIRE(batch.size() <= stream.maxBatchSize());
+                if (batch.empty())
+                    break;
+                result.insert(result.end(), batch.begin(), batch.end());
+            }
+        };
+        for (auto& chunk : chunks)
+        {
+            /* The stream must not keep references to earlier chunks. */
+            std::string buffer = chunk;
+            stream.write(buffer);
+            readBatches();
+            REQUIRE(stream.needsInput());
+            buffer.assign(buffer.size(), '#');
+        }
+        stream.close();
+        readBatches();
+        REQUIRE(stream.atEnd());
+        return result;
+    }
+}
+
+TEST_CASE("TimestampStream resumes lines that straddle chunks")
+{
+    std::string text = "2024-03-05T12:00:00\n"
+                       "2024-03-06T12:00:01\r\n"
+                       "\n"
+                       "garbage\n"
+                       "2024-03-07T12:00:02";
+    std::vector<PackedDateTime> expected = {
+        at(5, 0), at(6, 1), PackedDateTime(), PackedDateTime(), at(7, 2)
+    };
+
+    for (size_t i = 0; i <= text.size(); ++i)
+    {
+        for (size_t j = i; j <= text.size(); j += 7)
+        {
+            CAPTURE(i, j);
+            TimestampStream stream(makeParser(), 2);
+            auto values = readAll(stream, {text.substr(0, i),
+                                           text.substr(i, j - i),
+                                           text.substr(j)});
+            REQUIRE(values == expected);
+        }
+    }
+}
+
+TEST_CASE("TimestampStream returns bounded batches")
+{
+    TimestampStream stream(makeParser(), 2, PackedDateTime(1));
+    stream.write("2024-03-05T12:00:00\n2024-03-05T12:00:01\n"
+                 "2024-03-05T12:00:02\nx\n2024-03-05T12:");
+    REQUIRE(!stream.needsInput());
+    REQUIRE(stream.read().size() == 2);
+    REQUIRE_THROWS_AS(stream.write("00:03\n"), YtimeException);
+    REQUIRE(stream.read() == std::vector<PackedDateTime>{at(5, 2),
+                                                         PackedDateTime(1)});
+    REQUIRE(!stream.needsInput());
+    REQUIRE(stream.read().empty());
+    REQUIRE(stream.needsInput());
+
+    stream.write("00:03\n");
+    REQUIRE(stream.read() == std::vector<PackedDateTime>{at(5, 3)});
+    stream.close();
+    REQUIRE(stream.read().empty());
+    REQUIRE(stream.atEnd());
+    REQUIRE_THROWS_AS(stream.write("2024-03-05\n"), YtimeException);
+}
+
+TEST_CASE("TimestampStream with invalid batch size")
+{
+    REQUIRE_THROWS_AS(TimestampStream(makeParser(), 0), YtimeException);
+}
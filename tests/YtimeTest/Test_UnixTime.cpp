@@ -0,0 +1,80 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-19.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ytime/UnixTime.hpp"
+
+#include <algorithm>
+#include <vector>
+#include <catch2/catch.hpp>
+
+using namespace Ytime;
+
+TEST_CASE("Unix time around a leap second")
+{
+    REQUIRE(fromUnixTime(0) == pack({{1970, 1, 1}, {0, 0, 0}}));
+    REQUIRE(fromUnixTime(1483228799) == pack({{2016, 12, 31}, {23, 59, 59}}));
+    REQUIRE(fromUnixTime(1483228800) == pack({{2017, 1, 1}, {0, 0, 0}}));
+
+    REQUIRE(toUnixTime(pack({{2016, 12, 31}, {23, 59, 59}})) == 1483228799);
+    REQUIRE(toUnixTime(pack({{2016, 12, 31}, {23, 59, 60}})) == 1483228800);
+    REQUIRE(toUnixTime(pack({{2017, 1, 1}, {0, 0, 0}})) == 1483228800);
+    REQUIRE(toUnixTimeUsecs(pack({{2016, 12, 31}, {23, 59, 60, 500000}}))
+            == 1483228800500000);
+}
+
+TEST_CASE("Unix time before 1970")
+{
+    auto t = pack({{1969, 12, 31}, {23, 59, 59, 250000}});
+    REQUIRE(toUnixTime(t) == -1);
+    REQUIRE(toUnixTimeNsecs(t) == -750000000);
+    REQUIRE(fromUnixTimeNsecs(-750000000) == t);
+    auto ts = toTimespec(t);
+    REQUIRE(ts.tv_sec == -1);
+    REQUIRE(ts.tv_nsec == 250000000);
+    REQUIRE(fromTimespec(ts) == t);
+}
+
+TEST_CASE("NTP timestamps")
+{
+    auto t = pack({{2017, 1, 1}, {0, 0, 0}});
+    REQUIRE(toNtpTimestamp(t) == uint64_t(3692217600) << 32u);
+    REQUIRE(fromNtpTimestamp(uint64_t(3692217600) << 32u) == t);
+    REQUIRE(getNtpEra(t) == 0);
+
+    auto t2 = pack({{2024, 5, 1}, {12, 0, 0, 123457}});
+    REQUIRE(fromNtpTimestamp(toNtpTimestamp(t2)) == t2);
+
+    auto t3 = pack({{2036, 2, 7}, {6, 28, 16, 1}});
+    REQUIRE(getNtpEra(t3) == 1);
+    REQUIRE(toNtpTimestamp(t3) >> 32u == 0);
+    REQUIRE(fromNtpTimestamp(toNtpTimestamp(t3), 1) == t3);
+}
+
+TEST_CASE("Batch Unix time conversions match scalar conversions")
+{
+    std::vector<PackedDateTime> values;
+    auto t = pack({{2016, 12, 31}, {23, 0, 0}});
+    for (int i = 0; i < 1000; ++i)
+        values.push_back(add(t, Useconds(int64_t(i) * 7654321)));
+    std::reverse(values.begin() + 500, values.end());
+
+    std::vector<int64_t> usecs(values.size());
+    toUnixTimeUsecs(values.data(), values.size(), usecs.data());
+    for (size_t i = 0; i < values.size(); ++i)
+        REQUIRE(usecs[i] == toUnixTimeUsecs(values[i]));
+
+    std::vector<PackedDateTime> packed(values.size());
+    fromUnixTimeUsecs(usecs.data(), usecs.size(), packed.data());
+    for (size_t i = 0; i < values.size(); ++i)
+        REQUIRE(packed[i] == fromUnixTimeUsecs(usecs[i]));
+
+    std::vector<uint64_t> ntp(values.size());
+    toNtpTimestamp(values.data(), values.size(), ntp.data());
+    fromNtpTimestamp(ntp.data(), ntp.size(), packed.data());
+    for (size_t i = 0; i < values.size(); ++i)
+        REQUIRE(packed[i] == fromUnixTimeUsecs(usecs[i]));
+}
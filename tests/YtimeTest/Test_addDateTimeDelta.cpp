@@ -73,3 +73,15 @@ TEST_CASE("Negative, end on leap second from 23:59:59")
              Days(-7669) + Seconds(-86399),
              {{1999, 1, 1}, {0, 0, 0}});
 }
+
+TEST_CASE("Negative, leap seconds at start and end differ")
+{
+    /* Two leap seconds more before the start than before 23:59:58 on
+       the target day, but one of them is inserted after 23:59:58. */
+    checkSum({{1981, 6, 30}, {23, 59, 58, 112000}},
+             Days(-2008),
+             {{1975, 12, 31}, {23, 59, 58, 112000}});
+    checkSum({{1975, 12, 31}, {23, 59, 58, 112000}},
+             Days(2008),
+             {{1981, 6, 30}, {23, 59, 58, 112000}});
+}
@@ -137,3 +137,18 @@ TEST_CASE("Test delta days near leap seconds")
                {{2015, 6, 30}, {23, 59, 60}},
                Seconds(-86400));
 }
+
+TEST_CASE("Leap seconds at start and end differ")
+{
+    checkDelta({{1981, 6, 30}, {23, 59, 58, 112000}},
+               {{1975, 12, 31}, {23, 59, 58, 112000}},
+               Days(-2008));
+    checkDelta({{1975, 12, 31}, {23, 59, 58, 112000}},
+               {{1981, 6, 30}, {23, 59, 58, 112000}},
+               Days(2008));
+    /* The days stop at 1972-06-30T23:59:59.47, 1.54 seconds after the
+       end. */
+    checkDelta({{1976, 12, 31}, {23, 59, 59, 470000}},
+               {{1972, 6, 30}, {23, 59, 57, 930000}},
+               Days(-1645) + Useconds(-1540000));
+}